@@ -3,6 +3,13 @@
 #include "atmega32a_register_file.h"
 #include "bit_manipulation.h"
 #include "gpio.h"
+#include "scheduler.h"
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#ifndef F_CPU
+#define F_CPU                   16000000UL
+#endif
 
 #define ADC_FALSE				0
 #define ADC_TRUE				1
@@ -12,6 +19,58 @@
 #define ADEN                    7   /*Bit Index inside the REG_ADDCSRA*/
 #define ADSC                    6   /*Bit Index inside the REG_ADDCSRA*/
 #define ADIF                    4   /*Bit Index inside the REG_ADDCSRA*/
+#define ADIE                    3   /*Bit Index inside the REG_ADDCSRA*/
+#define I_BIT                   7   /*Bit Index inside the REG_SREG*/
+#define ADTS0                   5   /*Bit Index inside the REG_SFIOR*/
+
+/*Interrupt Flags that shall be cleared after each trigger. The Auto Trigger is started on the rising edge of the flag.*/
+#define TOV0_BIT                0   /*Bit Index inside the REG_TIFR*/
+#define OCF0_BIT                1   /*Bit Index inside the REG_TIFR*/
+#define TOV1_BIT                2   /*Bit Index inside the REG_TIFR*/
+#define OCF1B_BIT               3   /*Bit Index inside the REG_TIFR*/
+#define ICF1_BIT                5   /*Bit Index inside the REG_TIFR*/
+#define INTF0_BIT               6   /*Bit Index inside the REG_GIFR*/
+#define ACI_BIT                 4   /*Bit Index inside the REG_ACSR*/
+
+#define SE_BIT                  7   /*Bit Index inside the REG_MCUCR*/
+#define SM0_BIT                 4   /*Bit Index inside the REG_MCUCR*/
+
+#define ADC_RING_BUFFER_MASK    (ADC_RING_BUFFER_SIZE - 1)
+#define ADC_CLOCK_CYCLES_PER_CONVERSION     13
+
+#define EERE_BIT                0   /*Bit Index inside the REG_EECR*/
+#define EEWE_BIT                1   /*Bit Index inside the REG_EECR*/
+#define EEMWE_BIT               2   /*Bit Index inside the REG_EECR*/
+
+#define ADC_INTERNAL_REFERENCE_MILLIVOLTS   2560
+#define ADC_RESOLUTION_10_BITS_COUNT        10
+#define ADC_RESOLUTION_8_BITS_COUNT         8
+#define ADC_MILLIVOLTS_SCALE_SHIFT          16      /*The millivolt scales are in Q16*/
+#define ADC_Q15_SHIFT                       15
+#define ADC_Q15_FRACTION_MASK               0x7FFF
+#define ADC_CALIBRATION_BYTES_PER_CHANNEL   4
+#define ADC_EEPROM_ERASED_WORD              0xFFFF
+#define ADC_MAX_MILLIVOLTS                  0xFFFF
+
+/*Each extra bit of resolution needs 4 times the samples. 3 Extra bits (64 samples of 1023) still fit in a 16 Bits Accumulator.*/
+#define ADC_MAX_OVERSAMPLING_EXTRA_BITS     3
+#define ADC_OVERSAMPLING_SAMPLES_SHIFT      2
+
+#if ((ADC_RING_BUFFER_SIZE & ADC_RING_BUFFER_MASK) != 0) || (ADC_RING_BUFFER_SIZE > 128)
+#error "ADC_RING_BUFFER_SIZE shall be a power of 2 and shall not exceed 128."
+#endif
+
+/**
+ * @brief: The Consumer of the ADC Conversion Complete Interrupt.
+ */
+typedef enum
+{
+    ADC_ISR_MODE_NONE = 0,
+    ADC_ISR_MODE_RING_BUFFER,
+    ADC_ISR_MODE_BLOCK,
+    ADC_ISR_MODE_SCAN,
+    ADC_ISR_MODE_QUIET
+}enum_adc_isr_mode_type;
 
 /**
  * @brief : Description of the @value: Assigned in @ref: REG_ADMUX_6_BITS_MASK
@@ -23,6 +82,16 @@
 */
 #define REG_ADMUX_6_BITS_MASK   0x3F
 
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_ADMUX_5_BITS_MASK (MUX4:0 Bits)
+ * 
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| N/A   | N/A   | N/A   | 1     | 1     | 1     |  1    | 1     |
+|---------------------------------------------------------------|
+*/
+#define REG_ADMUX_5_BITS_MASK   0x1F
+
 /**
  * @brief : Description of the @value: Assigned in @ref: REG_ADCSRA_3_BITS_MASK
  * 
@@ -43,7 +112,351 @@
 */
 #define REG_ADCSRA_5_BITS_MASK   0x1F
 
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_MCUCR_SLEEP_BITS_MASK (SE and SM2:0 Bits)
+ * 
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| 1     | 1     | 1     | 1     | 0     | 0     |  0    | 0     |
+|---------------------------------------------------------------|
+*/
+#define REG_MCUCR_SLEEP_BITS_MASK       0xF0
+#define MCUCR_SLEEP_MODE_ADC_NOISE_REDUCTION    (1 << SM0_BIT)
+
 static uint8_type guint8_is_module_initialized = ADC_FALSE;
+static enum_adc_resolution_type genum_adc_resolution = ADC_RESOLUTION_10_BITS;
+static enum_adc_reference_type genum_adc_reference = ADC_REFERENCE_AVCC;
+
+/*Single Producer (ADC ISR) Single Consumer (Main Loop) Ring Buffer. Each index is written by one side only and a single byte access is atomic.*/
+static volatile uint16_type                 garr_uint16_ring_buffer[ADC_RING_BUFFER_SIZE];
+static volatile uint8_type                  guint8_ring_buffer_head         = 0;
+static volatile uint8_type                  guint8_ring_buffer_tail         = 0;
+static volatile uint16_type                 guint16_dropped_samples         = 0;
+static volatile enum_adc_isr_mode_type      genum_adc_isr_mode              = ADC_ISR_MODE_NONE;
+static enum_adc_trigger_source_type         genum_adc_trigger_source        = ADC_TRIGGER_FREE_RUNNING;
+static volatile uint8_type*                 gpuint8_trigger_flag_register   = NULL_PTR;
+static uint8_type                           guint8_trigger_flag_mask        = 0;
+static uint8_type                           guint8_trigger_keep_mask        = 0;    /*Bits of the flag register that hold configurations and shall be written back.*/
+
+/*Block Acquisition Database*/
+static uint16_type*                         gpu16_block_a                   = NULL_PTR;
+static uint16_type*                         gpu16_block_b                   = NULL_PTR;
+static uint16_type* volatile                gpu16_block_filling             = NULL_PTR;
+static uint16_type                          guint16_block_length            = 0;
+static volatile uint16_type                 guint16_block_index             = 0;
+static volatile uint8_type                  guint8_block_is_held            = ADC_FALSE;    /*The other block is still processed by the application*/
+static pointer_func_adc_block_callback_type gpointer_func_block_callback    = NULL_PTR;
+
+/*Scan Sequencer Database*/
+static uint8_type                           garr_uint8_scan_mux_codes[ADC_SCAN_MAX_CHANNELS];
+static volatile struct_adc_scan_result_type garr_str_scan_results[ADC_SCAN_MAX_CHANNELS];
+static uint8_type                           guint8_scan_number_of_channels  = 0;
+static volatile uint8_type                  guint8_scan_completed_slot      = 0;    /*The Slot of the conversion that raises the current interrupt*/
+static volatile uint8_type                  guint8_scan_running_slot        = 0;    /*The Slot of the conversion that is started automatically while the ISR runs*/
+static uint8_type                           guint8_scan_is_pipelined        = ADC_FALSE;    /*Only the free running conversions start before the ISR runs*/
+
+/*Oversampling and Decimation Database*/
+static uint8_type                           guint8_oversampling_extra_bits  = 0;
+static uint8_type                           guint8_oversampling_reload      = 1;    /*4^n samples per output*/
+static volatile uint8_type                  guint8_oversampling_countdown   = 1;
+static volatile uint16_type                 guint16_oversampling_sum        = 0;
+static volatile uint32_type                 guint32_scan_conversion_counter = 0;
+
+/*Noise Reduction Conversion Database*/
+static volatile uint16_type                 guint16_quiet_value             = 0;
+static volatile uint8_type                  guint8_quiet_is_done            = ADC_FALSE;
+
+/*Millivolt Conversion Database. The scales and the offsets are recomputed when any of their inputs changes.*/
+static struct_adc_calibration_type          garr_str_calibration[ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS];
+static uint32_type                          garr_uint32_millivolts_scale_q16[ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS];
+static sint16_type                          garr_sint16_scaled_offset[ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS];
+
+static void start_auto_triggered_conversions(void);
+static uint16_type read_conversion_result(void);
+static uint8_type read_eeprom_byte(uint16_type uint16_address);
+static void write_eeprom_byte(uint16_type uint16_address, uint8_type uint8_data);
+static void load_calibration_table(void);
+static void update_millivolts_scales(void);
+
+/**
+ * @brief: Function that is used to read one Byte from the EEPROM.
+ * @return uint8_type: The Byte stored at the address.
+ */
+static uint8_type read_eeprom_byte(uint16_type uint16_address)
+{
+    /*Wait for the completion of any previous write. (Up to 8.5 ms) The higher priority tasks can run meanwhile.*/
+    while(GET_BIT(REG_EECR, EEWE_BIT) != 0)
+    {
+        SCHEDULER_YIELD();
+    }
+    REG_EEARH = (uint8_type)(uint16_address >> 8);
+    REG_EEARL = (uint8_type)(uint16_address);
+    SET_BIT(REG_EECR, EERE_BIT);
+    return REG_EEDR;
+}
+
+/**
+ * @brief: Function that is used to write one Byte in the EEPROM.
+ * @return None
+ */
+static void write_eeprom_byte(uint16_type uint16_address, uint8_type uint8_data)
+{
+    uint8_type uint8_sreg = 0;
+
+    /*Wait for the completion of any previous write. (Up to 8.5 ms) The higher priority tasks can run meanwhile.*/
+    while(GET_BIT(REG_EECR, EEWE_BIT) != 0)
+    {
+        SCHEDULER_YIELD();
+    }
+    REG_EEARH = (uint8_type)(uint16_address >> 8);
+    REG_EEARL = (uint8_type)(uint16_address);
+    REG_EEDR  = uint8_data;
+
+    /*The EEWE shall be set within 4 cycles after setting the EEMWE. So no interrupt is allowed between them.*/
+    uint8_sreg = REG_SREG;
+    CLEAR_BIT(REG_SREG, I_BIT);
+    REG_EECR = (1<<EEMWE_BIT);
+    REG_EECR = (1<<EEMWE_BIT) | (1<<EEWE_BIT);
+    REG_SREG = uint8_sreg;
+}
+
+/**
+ * @brief: Function that is used to load the calibration of all the single ended channels from the EEPROM.
+ *         An erased entry (Gain 0xFFFF) is loaded as offset 0 and gain 1.0.
+ * @return None
+ */
+static void load_calibration_table(void)
+{
+    uint8_type  uint8_channel   = 0;
+    uint16_type uint16_address  = ADC_CALIBRATION_EEPROM_ADDRESS;
+    uint16_type uint16_offset   = 0;
+    uint16_type uint16_gain     = 0;
+    for(uint8_channel = 0; uint8_channel < ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS; uint8_channel++)
+    {
+        uint16_offset   = read_eeprom_byte(uint16_address) | ((uint16_type)read_eeprom_byte(uint16_address + 1) << 8);
+        uint16_gain     = read_eeprom_byte(uint16_address + 2) | ((uint16_type)read_eeprom_byte(uint16_address + 3) << 8);
+        if(uint16_gain == ADC_EEPROM_ERASED_WORD)
+        {
+            garr_str_calibration[uint8_channel].sint16_offset   = 0;
+            garr_str_calibration[uint8_channel].uint16_gain_q15 = ADC_CALIBRATION_GAIN_ONE;
+        }
+        else
+        {
+            garr_str_calibration[uint8_channel].sint16_offset   = (sint16_type)uint16_offset;
+            garr_str_calibration[uint8_channel].uint16_gain_q15 = uint16_gain;
+        }
+        uint16_address += ADC_CALIBRATION_BYTES_PER_CHANNEL;
+    }
+}
+
+/**
+ * @brief: Function that is used to fold the reference, the resolution, the oversampling and the calibration of each channel in a Q16 scale.
+ *         millivolts = ((raw - offset) * scale) >> 16. Where scale = Vref_mV * 2^16 / 2^bits * gain.
+ * @return None
+ */
+static void update_millivolts_scales(void)
+{
+    uint8_type  uint8_channel       = 0;
+    uint8_type  uint8_bits          = 0;
+    uint32_type uint32_base_scale   = 0;
+    uint32_type uint32_gain         = 0;
+    sint16_type sint16_offset       = 0;
+
+    if(genum_adc_reference == ADC_REFERENCE_INTERNAL_2_56V)
+    {
+        uint32_base_scale = ADC_INTERNAL_REFERENCE_MILLIVOLTS;
+    }
+    else if(genum_adc_reference == ADC_REFERENCE_AREF)
+    {
+        uint32_base_scale = ADC_AREF_MILLIVOLTS;
+    }
+    else
+    {
+        uint32_base_scale = ADC_AVCC_MILLIVOLTS;
+    }
+
+    if(genum_adc_resolution == ADC_RESOLUTION_8_BITS)
+    {
+        uint8_bits = ADC_RESOLUTION_8_BITS_COUNT + guint8_oversampling_extra_bits;
+    }
+    else
+    {
+        uint8_bits = ADC_RESOLUTION_10_BITS_COUNT + guint8_oversampling_extra_bits;
+    }
+    uint32_base_scale <<= (ADC_MILLIVOLTS_SCALE_SHIFT - uint8_bits);
+
+    for(uint8_channel = 0; uint8_channel < ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS; uint8_channel++)
+    {
+        /*Q16 x Q15 split in two products. So none of them overflows 32 Bits.*/
+        uint32_gain = garr_str_calibration[uint8_channel].uint16_gain_q15;
+        garr_uint32_millivolts_scale_q16[uint8_channel] =   ((uint32_base_scale >> ADC_Q15_SHIFT) * uint32_gain) +
+                                                            (((uint32_base_scale & ADC_Q15_FRACTION_MASK) * uint32_gain) >> ADC_Q15_SHIFT);
+
+        /*The offset is stored in 10 Bits LSBs.*/
+        sint16_offset = garr_str_calibration[uint8_channel].sint16_offset;
+        if(genum_adc_resolution == ADC_RESOLUTION_8_BITS)
+        {
+            sint16_offset = sint16_offset / 4;
+        }
+        garr_sint16_scaled_offset[uint8_channel] = (sint16_type)(sint16_offset * (1 << guint8_oversampling_extra_bits));
+    }
+}
+
+/**
+ * @brief: Function that is used to read the result of the last conversion in the selected resolution.
+ *         In the 8 Bits resolution the result is left adjusted. So reading the ADCH only is enough and saves the ADCL access.
+ * @return uint16_type: The conversion result.
+ */
+static uint16_type read_conversion_result(void)
+{
+    uint16_type uint16_adc_value = 0;
+    if(genum_adc_resolution == ADC_RESOLUTION_8_BITS)
+    {
+        uint16_adc_value = REG_ADCH;
+    }
+    else
+    {
+        uint16_adc_value = REG_ADC;
+    }
+    return uint16_adc_value;
+}
+
+/**
+ * @brief: Function that is used to apply the selected trigger source and start the interrupt driven conversions.
+ *         In the free running mode the first conversion is started here. Otherwise the first trigger starts it.
+ * @return None
+ */
+static void start_auto_triggered_conversions(void)
+{
+    REG_SFIOR = (REG_SFIOR & REG_ADCSRA_5_BITS_MASK) | (uint8_type)(genum_adc_trigger_source << ADTS0);
+
+    SET_BIT(REG_ADCSRA, ADIF);
+    SET_BIT(REG_ADCSRA, ADATE);
+    SET_BIT(REG_ADCSRA, ADIE);
+    SET_BIT(REG_SREG, I_BIT);
+    SET_BIT(REG_ADCSRA, ADEN);
+    if(genum_adc_trigger_source == ADC_TRIGGER_FREE_RUNNING)
+    {
+        SET_BIT(REG_ADCSRA, ADSC);
+    }
+}
+
+ISR(ADC_vect)
+{
+    uint16_type uint16_adc_value        = read_conversion_result();
+    uint8_type  uint8_is_output_ready   = ADC_TRUE;
+    uint8_type  uint8_next_head;
+    uint16_type* pu16_full_block;
+
+    if((gpuint8_trigger_flag_register != NULL_PTR) && (genum_adc_isr_mode != ADC_ISR_MODE_QUIET))
+    {
+        /*Interrupt Flags are cleared by writing 1. So the next trigger edge can occur even if the timer interrupt is not used.*/
+        *gpuint8_trigger_flag_register = guint8_trigger_flag_mask | ((*gpuint8_trigger_flag_register) & guint8_trigger_keep_mask);
+    }
+
+    if((guint8_oversampling_reload > 1) && ((genum_adc_isr_mode == ADC_ISR_MODE_RING_BUFFER) || (genum_adc_isr_mode == ADC_ISR_MODE_BLOCK)))
+    {
+        /*Accumulate 4^n samples then decimate by shifting right n bits. The output has (resolution + n) bits.*/
+        guint16_oversampling_sum += uint16_adc_value;
+        guint8_oversampling_countdown--;
+        if(guint8_oversampling_countdown == 0)
+        {
+            uint16_adc_value                = guint16_oversampling_sum >> guint8_oversampling_extra_bits;
+            guint16_oversampling_sum        = 0;
+            guint8_oversampling_countdown   = guint8_oversampling_reload;
+        }
+        else
+        {
+            uint8_is_output_ready = ADC_FALSE;
+        }
+    }
+
+    switch((uint8_is_output_ready == ADC_TRUE) ? genum_adc_isr_mode : ADC_ISR_MODE_NONE)
+    {
+        case ADC_ISR_MODE_RING_BUFFER:
+        {
+            uint8_next_head = (guint8_ring_buffer_head + 1) & ADC_RING_BUFFER_MASK;
+            if(uint8_next_head != guint8_ring_buffer_tail)
+            {
+                garr_uint16_ring_buffer[guint8_ring_buffer_head] = uint16_adc_value;
+                guint8_ring_buffer_head = uint8_next_head;
+            }
+            else if(guint16_dropped_samples != 0xFFFF)
+            {
+                /*The Application didn't drain the buffer in time. The New sample is dropped.*/
+                guint16_dropped_samples++;
+            }
+            break;
+        }
+        case ADC_ISR_MODE_BLOCK:
+        {
+            gpu16_block_filling[guint16_block_index] = uint16_adc_value;
+            guint16_block_index++;
+            if(guint16_block_index == guint16_block_length)
+            {
+                guint16_block_index = 0;
+                if(guint8_block_is_held == ADC_FALSE)
+                {
+                    /*Swap the blocks. Then hand the full one to the application.*/
+                    pu16_full_block         = gpu16_block_filling;
+                    gpu16_block_filling     = (pu16_full_block == gpu16_block_a) ? gpu16_block_b : gpu16_block_a;
+                    guint8_block_is_held    = ADC_TRUE;
+                    gpointer_func_block_callback(pu16_full_block, guint16_block_length);
+                }
+                else if((0xFFFF - guint16_dropped_samples) >= guint16_block_length)
+                {
+                    /*The Application still holds the other block. The full block is refilled.*/
+                    guint16_dropped_samples += guint16_block_length;
+                }
+                else
+                {
+                    guint16_dropped_samples = 0xFFFF;
+                }
+            }
+            break;
+        }
+        case ADC_ISR_MODE_SCAN:
+        {
+            garr_str_scan_results[guint8_scan_completed_slot].uint16_value      = uint16_adc_value;
+            garr_str_scan_results[guint8_scan_completed_slot].uint32_timestamp  = guint32_scan_conversion_counter;
+            guint32_scan_conversion_counter++;
+
+            if(guint8_scan_is_pipelined == ADC_TRUE)
+            {
+                /*  The next conversion has already started with the MUX latched at its start.
+                    So the MUX written here is used by the conversion after it. No conversion is thrown away.*/
+                guint8_scan_completed_slot = guint8_scan_running_slot;
+                guint8_scan_running_slot++;
+                if(guint8_scan_running_slot == guint8_scan_number_of_channels)
+                {
+                    guint8_scan_running_slot = 0;
+                }
+                REG_ADMUX = garr_uint8_scan_mux_codes[guint8_scan_running_slot] | (REG_ADMUX & 0xE0);
+            }
+            else
+            {
+                /*The next conversion waits for the next trigger. So the MUX written here is used directly by it.*/
+                guint8_scan_completed_slot++;
+                if(guint8_scan_completed_slot == guint8_scan_number_of_channels)
+                {
+                    guint8_scan_completed_slot = 0;
+                }
+                REG_ADMUX = garr_uint8_scan_mux_codes[guint8_scan_completed_slot] | (REG_ADMUX & 0xE0);
+            }
+            break;
+        }
+        case ADC_ISR_MODE_QUIET:
+        {
+            guint16_quiet_value     = uint16_adc_value;
+            guint8_quiet_is_done    = ADC_TRUE;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
 /**
  * @brief: Function used to initialize the adc peripheral. 
  * 
@@ -58,6 +471,7 @@ sint32_type adc_init(void)
         /*Select Voltage Reference*/
         /*Note: You can use SETBIT(REG_ADMUX, REFS0) will do the same result.*/
         REG_ADMUX = (1<<REFS0) | (REG_ADMUX & 0x3F);
+        genum_adc_reference = ADC_REFERENCE_AVCC;
         
         /*Select Adjustment (Right Adjustment)*/
         CLEAR_BIT(REG_ADMUX, ADLAR);    /*Default Value assigned in the register.*/
@@ -70,6 +484,10 @@ sint32_type adc_init(void)
 
         /*Conversion Trigger Source*/
         REG_SFIOR &=REG_ADCSRA_5_BITS_MASK;
+
+        /*Calibration of the millivolt conversion*/
+        load_calibration_table();
+        update_millivolts_scales();
         
         guint8_is_module_initialized = ADC_TRUE;
     }
@@ -143,16 +561,27 @@ sint32_type adc_read_value(uint16_type* pu16_adc_value)
     {
         if(pu16_adc_value != NULL_PTR)
         {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                /*Clear any stale Conversion Complete Flag by writing 1 to it. Otherwise the wait below returns immediately with old data.*/
+                SET_BIT(REG_ADCSRA, ADIF);
+
+                /*Start a conversion in ADC*/
+                SET_BIT(REG_ADCSRA, ADSC);
 
-            /*Start a conversion in ADC*/
-            SET_BIT(REG_ADCSRA, ADSC);
+                /*Wait until the conversion is done*/
+                while(GET_BIT(REG_ADCSRA, ADIF) == 0);
 
-            /*Wait until the conversion is done*/
-            while(GET_BIT(REG_ADCSRA, ADIF) == 0);
+                /*Store The Value inside the passed variable.*/
+                *pu16_adc_value = read_conversion_result();
 
-            /*Store The Value inside the passed variable.*/
-            *pu16_adc_value = REG_ADC;
-			
+                SET_BIT(REG_ADCSRA, ADIF);
+            }
+            else
+            {
+                /*The Conversion Complete Interrupt is owned by a running acquisition.*/
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
         }
         else
         {
@@ -164,4 +593,815 @@ sint32_type adc_read_value(uint16_type* pu16_adc_value)
         sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
     }
     return sint32_retval;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief: Function that is used to read the value of a conversion done in the ADC Noise Reduction sleep mode.
+ *         Entering the sleep mode stops the CPU and the I/O clocks and starts the conversion. The ADC Conversion Complete Interrupt wakes the CPU up.
+ *         So the digital switching noise is removed during the conversion and the CPU doesn't consume power while waiting.
+ * @note:  The Global Interrupts are enabled while sleeping. Then the SREG is restored.
+ *         Any other interrupt wakes the CPU up early. In that case the function sleeps again until the conversion is done.
+ *         The timers clocked by the I/O clock stop during the conversion. Only the asynchronous Timer 2 keeps counting.
+ * 
+ * @param[in] pu16_adc_value:   Address of a variable in which the value will be stored.
+ * @return sint32_type:         SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: pu16_adc_value is NULL_POINTER 
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_read_value_quiet(uint16_type* pu16_adc_value)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg          = 0;
+    uint8_type  uint8_adcsra        = 0;
+    uint8_type  uint8_mcucr         = 0;
+    uint8_type  uint8_is_free_running = ADC_FALSE;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if(pu16_adc_value != NULL_PTR)
+        {
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                genum_adc_isr_mode      = ADC_ISR_MODE_QUIET;
+                guint8_quiet_is_done    = ADC_FALSE;
+
+                /*In the Free Running mode the ADSC Bit stays 1. So the Auto Trigger is disabled first and the conversion in progress is the last one.*/
+                uint8_adcsra = REG_ADCSRA;
+                uint8_is_free_running = ((GET_BIT(uint8_adcsra, ADATE) != 0) && (GET_BIT(uint8_adcsra, ADSC) != 0) && ((REG_SFIOR & (uint8_type)(~REG_ADCSRA_5_BITS_MASK)) == 0)) ? ADC_TRUE : ADC_FALSE;
+                uint8_adcsra = uint8_adcsra & (uint8_type)(~((1<<ADIF) | (1<<ADSC)));
+                REG_ADCSRA = uint8_adcsra & (uint8_type)(~(1<<ADATE));
+
+                /*The sleep instruction starts a conversion only if no conversion is in progress.*/
+                while(GET_BIT(REG_ADCSRA, ADSC) != 0);
+
+                /*Single conversion started by the sleep instruction. The flag of the previous conversion is cleared so it doesn't wake the CPU up.*/
+                REG_ADCSRA = (uint8_adcsra & (uint8_type)(~(1<<ADATE))) | (1<<ADIF) | (1<<ADIE) | (1<<ADEN);
+
+                uint8_mcucr = REG_MCUCR;
+                REG_MCUCR = (uint8_mcucr & (uint8_type)(~REG_MCUCR_SLEEP_BITS_MASK)) | MCUCR_SLEEP_MODE_ADC_NOISE_REDUCTION | (1<<SE_BIT);
+
+                while(guint8_quiet_is_done == ADC_FALSE)
+                {
+                    /*The instruction after sei is executed before any pending interrupt. So the wake up can't be missed between the check and the sleep.*/
+                    sei();
+                    sleep_cpu();
+                    cli();
+                }
+
+                REG_MCUCR = uint8_mcucr;
+                /*Restore the previous configuration. The ADIF Bit is written as 0 so it's not affected. The Free Running conversions are started again.*/
+                REG_ADCSRA = (uint8_is_free_running == ADC_TRUE) ? (uint8_adcsra | (1<<ADSC)) : uint8_adcsra;
+                genum_adc_isr_mode = ADC_ISR_MODE_NONE;
+
+                /*Store The Value inside the passed variable.*/
+                *pu16_adc_value = guint16_quiet_value;
+            }
+            else
+            {
+                /*The Conversion Complete Interrupt is owned by a running acquisition.*/
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to start the free running conversions on a specific channel.
+ *         Each conversion result is pushed by the ADC Conversion Complete ISR inside a ring buffer of @ref: ADC_RING_BUFFER_SIZE samples.
+ *         The Application shall drain it using @ref: adc_read_samples
+ * 
+ * @param[in] uint8_channel:    The MUX Channel to convert.
+ * @return sint32_type:         SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid channel.
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_start_free_running(uint8_type uint8_channel)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if(uint8_channel <= REG_ADMUX_5_BITS_MASK)
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                guint8_ring_buffer_head = 0;
+                guint8_ring_buffer_tail = 0;
+                guint16_dropped_samples = 0;
+                guint16_oversampling_sum        = 0;
+                guint8_oversampling_countdown   = guint8_oversampling_reload;
+                genum_adc_isr_mode      = ADC_ISR_MODE_RING_BUFFER;
+
+                REG_ADMUX = (uint8_channel) | (REG_ADMUX & 0xE0);
+                start_auto_triggered_conversions();
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to stop the free running conversions. (Ring Buffer, Block Acquisition or Scan Sequencer)
+ * @note:  The samples that are still in the ring buffer can be drained after stopping.
+ * 
+ * @return sint32_type: SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ */
+sint32_type adc_stop_free_running(void)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        CLEAR_BIT(REG_ADCSRA, ADIE);
+        CLEAR_BIT(REG_ADCSRA, ADATE);
+        genum_adc_isr_mode = ADC_ISR_MODE_NONE;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to drain a batch of samples from the ring buffer filled by the free running conversions.
+ * 
+ * @param[out] pu16_samples:            Address of the array in which the samples will be stored.
+ * @param[in]  uint8_max_samples:       The Maximum Number of samples the array can hold.
+ * @param[out] puint8_samples_read:     Address of a variable in which the number of the copied samples will be stored.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success. (Including the case of empty ring buffer)
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of NULL_PTR arguments.
+ */
+sint32_type adc_read_samples(uint16_type* pu16_samples, uint8_type uint8_max_samples, uint8_type* puint8_samples_read)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_head      = 0;
+    uint8_type  uint8_tail      = 0;
+    uint8_type  uint8_count     = 0;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if((pu16_samples != NULL_PTR) && (puint8_samples_read != NULL_PTR))
+        {
+            /*Take a snapshot of the producer index once. Samples pushed after this point are left for the next call.*/
+            uint8_head = guint8_ring_buffer_head;
+            uint8_tail = guint8_ring_buffer_tail;
+            while((uint8_tail != uint8_head) && (uint8_count < uint8_max_samples))
+            {
+                pu16_samples[uint8_count] = garr_uint16_ring_buffer[uint8_tail];
+                uint8_tail = (uint8_tail + 1) & ADC_RING_BUFFER_MASK;
+                uint8_count++;
+            }
+            guint8_ring_buffer_tail = uint8_tail;
+            *puint8_samples_read    = uint8_count;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to get the number of samples dropped because the ring buffer was full or the block was not released in time.
+ * 
+ * @param[out] pu16_dropped_samples:    Address of a variable in which the counter will be stored. The counter saturates at 0xFFFF.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: pu16_dropped_samples is NULL_POINTER
+ */
+sint32_type adc_get_dropped_samples(uint16_type* pu16_dropped_samples)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(pu16_dropped_samples != NULL_PTR)
+    {
+        /*16 Bits read shall not be interrupted by the ISR.*/
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        *pu16_dropped_samples = guint16_dropped_samples;
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to start the double buffered block acquisition on a specific channel.
+ *         The ADC Conversion Complete ISR fills one block while the application processes the other one.
+ *         When a block is full the ISR switches to the other block and calls the callback with the full block.
+ *         The Application shall call @ref: adc_release_block when it finishes processing the block. (Inside the callback or later from the main loop)
+ * @note:  If the ISR fills a block while the other one is still not released, the filled block is dropped and refilled.
+ *         Its samples are added to the counter of @ref: adc_get_dropped_samples. So the released block is never overwritten.
+ *         The acquisition is stopped by @ref: adc_stop_free_running
+ * 
+ * @param[in] uint8_channel:                The MUX Channel to convert.
+ * @param[in] pu16_block_a:                 Address of the first block.
+ * @param[in] pu16_block_b:                 Address of the second block.
+ * @param[in] uint16_block_length:          Number of samples in each block.
+ * @param[in] pointer_func_block_callback:  The function called from the ISR with each full block.
+ * @return sint32_type:                     SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_start_block_acquisition(uint8_type uint8_channel, uint16_type* pu16_block_a, uint16_type* pu16_block_b, uint16_type uint16_block_length, pointer_func_adc_block_callback_type pointer_func_block_callback)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if( (uint8_channel <= REG_ADMUX_5_BITS_MASK) && (pu16_block_a != NULL_PTR) && (pu16_block_b != NULL_PTR) &&
+            (pu16_block_a != pu16_block_b) && (uint16_block_length > 0) && (pointer_func_block_callback != NULL_PTR))
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                gpu16_block_a                   = pu16_block_a;
+                gpu16_block_b                   = pu16_block_b;
+                gpu16_block_filling             = pu16_block_a;
+                guint16_block_length            = uint16_block_length;
+                guint16_block_index             = 0;
+                guint8_block_is_held            = ADC_FALSE;
+                gpointer_func_block_callback    = pointer_func_block_callback;
+                guint16_dropped_samples         = 0;
+                guint16_oversampling_sum        = 0;
+                guint8_oversampling_countdown   = guint8_oversampling_reload;
+                genum_adc_isr_mode              = ADC_ISR_MODE_BLOCK;
+
+                REG_ADMUX = (uint8_channel) | (REG_ADMUX & 0xE0);
+                start_auto_triggered_conversions();
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to give the last full block back to the ISR after processing it.
+ * 
+ * @return sint32_type: SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ */
+sint32_type adc_release_block(void)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        /*Single Byte write. So it's atomic against the ISR.*/
+        guint8_block_is_held = ADC_FALSE;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to start the scan sequencer over a list of MUX codes in free running mode.
+ *         The ADMUX is rotated inside the Conversion Complete ISR while the next conversion is already running. So there is no throwaway conversion on each channel switch.
+ *         The latest result of each list entry is stored with its conversion index as a timestamp. Each conversion takes 13 ADC Clock Cycles.
+ * @note:  The first result of the first entry is converted twice after the start. The first conversion after switching to a differential gain channel may be less accurate.
+ * 
+ * @param[in] puint8_mux_codes:         Address of the array of the MUX codes (Single ended channels 0x00-0x07 or Differential/Gain codes 0x08-0x1F).
+ * @param[in] uint8_number_of_channels: Number of entries in the array. @note: This shall be less than or equal to @ref: ADC_SCAN_MAX_CHANNELS
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_start_scan(const uint8_type* puint8_mux_codes, uint8_type uint8_number_of_channels)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_iterator  = 0;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if((puint8_mux_codes != NULL_PTR) && (uint8_number_of_channels > 0) && (uint8_number_of_channels <= ADC_SCAN_MAX_CHANNELS))
+        {
+            for(uint8_iterator = 0; uint8_iterator < uint8_number_of_channels; uint8_iterator++)
+            {
+                if(puint8_mux_codes[uint8_iterator] > REG_ADMUX_5_BITS_MASK)
+                {
+                    sint32_retval = ERROR_INVALID_ARGUMENTS;
+                    break;
+                }
+            }
+            if(guint8_oversampling_reload > 1)
+            {
+                /*The Decimation is done on a single channel only.*/
+                sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+            }
+            if(sint32_retval == SUCCESS_RETVAL)
+            {
+                if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+                {
+                    for(uint8_iterator = 0; uint8_iterator < uint8_number_of_channels; uint8_iterator++)
+                    {
+                        garr_uint8_scan_mux_codes[uint8_iterator]                   = puint8_mux_codes[uint8_iterator];
+                        garr_str_scan_results[uint8_iterator].uint16_value          = 0;
+                        garr_str_scan_results[uint8_iterator].uint32_timestamp      = 0;
+                    }
+                    guint8_scan_number_of_channels  = uint8_number_of_channels;
+                    guint8_scan_completed_slot      = 0;
+                    guint8_scan_running_slot        = 0;
+                    guint8_scan_is_pipelined        = (genum_adc_trigger_source == ADC_TRIGGER_FREE_RUNNING) ? ADC_TRUE : ADC_FALSE;
+                    guint32_scan_conversion_counter = 0;
+                    genum_adc_isr_mode              = ADC_ISR_MODE_SCAN;
+
+                    REG_ADMUX = garr_uint8_scan_mux_codes[0] | (REG_ADMUX & 0xE0);
+                    start_auto_triggered_conversions();
+                }
+                else
+                {
+                    sint32_retval = ERROR_MODULE_BUSY;
+                }
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to get the latest result of a specific entry in the scan list.
+ * 
+ * @param[in]  uint8_slot_index:    Index of the entry inside the list passed to @ref: adc_start_scan
+ * @param[out] pstr_scan_result:    Address of a structure in which the result and its timestamp will be stored.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ */
+sint32_type adc_get_scan_result(uint8_type uint8_slot_index, struct_adc_scan_result_type* pstr_scan_result)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if((pstr_scan_result != NULL_PTR) && (uint8_slot_index < guint8_scan_number_of_channels))
+        {
+            /*The Value and the timestamp shall be copied as one unit.*/
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            pstr_scan_result->uint16_value      = garr_str_scan_results[uint8_slot_index].uint16_value;
+            pstr_scan_result->uint32_timestamp  = garr_str_scan_results[uint8_slot_index].uint32_timestamp;
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to select the Auto Trigger Source of the interrupt driven conversions. (ADTS Bits)
+ *         Using a timer as a trigger source gives fixed and jitter-free sample intervals.
+ *         Example: Timer 0 in TIMER_MODE_CTC with TIMER_8_PRESCALAR and compare value 199 triggers the ADC at F_CPU / (8 * 200) = 10 KHz @ 16 MHz.
+ * @note:  The trigger flag is cleared inside the ADC ISR. So the timer interrupt doesn't need to be enabled (TIMER_USAGE_POLLING can be used).
+ *         The conversion time (13 ADC Clock Cycles) shall be less than the trigger period.
+ *         The new source is applied on the next call to @ref: adc_start_free_running or @ref: adc_start_scan.
+ * 
+ * @param[in] enum_adc_trigger_source:  The Required Trigger Source.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid trigger source.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_trigger_source(enum_adc_trigger_source_type enum_adc_trigger_source)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if(enum_adc_trigger_source < ADC_TRIGGER_INVALID)
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                genum_adc_trigger_source = enum_adc_trigger_source;
+                guint8_trigger_keep_mask = 0;
+                switch(enum_adc_trigger_source)
+                {
+                    case ADC_TRIGGER_ANALOG_COMPARATOR:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_ACSR;
+                        guint8_trigger_flag_mask        = (1<<ACI_BIT);
+                        guint8_trigger_keep_mask        = (uint8_type)(~(1<<ACI_BIT));
+                        break;
+                    }
+                    case ADC_TRIGGER_EXTERNAL_INTERRUPT_0:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_GIFR;
+                        guint8_trigger_flag_mask        = (1<<INTF0_BIT);
+                        break;
+                    }
+                    case ADC_TRIGGER_TIMER_0_COMPARE_MATCH:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_TIFR;
+                        guint8_trigger_flag_mask        = (1<<OCF0_BIT);
+                        break;
+                    }
+                    case ADC_TRIGGER_TIMER_0_OVERFLOW:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_TIFR;
+                        guint8_trigger_flag_mask        = (1<<TOV0_BIT);
+                        break;
+                    }
+                    case ADC_TRIGGER_TIMER_1_COMPARE_MATCH_B:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_TIFR;
+                        guint8_trigger_flag_mask        = (1<<OCF1B_BIT);
+                        break;
+                    }
+                    case ADC_TRIGGER_TIMER_1_OVERFLOW:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_TIFR;
+                        guint8_trigger_flag_mask        = (1<<TOV1_BIT);
+                        break;
+                    }
+                    case ADC_TRIGGER_TIMER_1_CAPTURE_EVENT:
+                    {
+                        gpuint8_trigger_flag_register   = &REG_TIFR;
+                        guint8_trigger_flag_mask        = (1<<ICF1_BIT);
+                        break;
+                    }
+                    default:
+                    {
+                        /*Free Running. No Flag to clear.*/
+                        gpuint8_trigger_flag_register   = NULL_PTR;
+                        guint8_trigger_flag_mask        = 0;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to configure the oversampling and decimation inside the ADC ISR.
+ *         4^n conversions are accumulated for each output sample. Then the sum is shifted right n bits. So the output sample has (resolution + n) bits: 10 + n with @ref: ADC_RESOLUTION_10_BITS and 8 + n with @ref: ADC_RESOLUTION_8_BITS.
+ *         The output sample rate is the conversion rate divided by 4^n.
+ * @note:  The extra resolution is real only when the input has about 1 LSB of (white) noise. A clean and stable input gives the same code on each conversion.
+ *         In that case add dither: Ex: a triangular signal of 1-2 LSB peak to peak summed on the input through a high value resistor from a PWM pin and an RC filter.
+ *         The dither period shall be a multiple of the 4^n samples window so it averages out.
+ *         The Decimation is applied to @ref: adc_start_free_running and @ref: adc_start_block_acquisition only.
+ * 
+ * @param[in] uint8_extra_bits:     The number of extra bits (n). 0 disables the oversampling. @note: This shall not exceed 3
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid number of bits.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_oversampling(uint8_type uint8_extra_bits)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if(uint8_extra_bits <= ADC_MAX_OVERSAMPLING_EXTRA_BITS)
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                guint8_oversampling_extra_bits  = uint8_extra_bits;
+                guint8_oversampling_reload      = (uint8_type)(1 << (uint8_extra_bits * ADC_OVERSAMPLING_SAMPLES_SHIFT));
+                guint8_oversampling_countdown   = guint8_oversampling_reload;
+                guint16_oversampling_sum        = 0;
+                update_millivolts_scales();
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to select the ADC Clock Prescaler. The default is @ref: ADC_PRESCALER_128
+ * 
+ * @param[in] enum_adc_prescaler:   The ADC Clock Prescaler.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid prescaler.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_prescaler(enum_adc_prescaler_type enum_adc_prescaler)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if((enum_adc_prescaler >= ADC_PRESCALER_2) && (enum_adc_prescaler < ADC_PRESCALER_INVALID))
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                /*The ADIF is written as 0. So a pending Conversion Complete Flag is not cleared by this write.*/
+                REG_ADCSRA = (REG_ADCSRA & (uint8_type)(~(REG_ADCSRA_3_BITS_MASK | (1<<ADIF)))) | (uint8_type)enum_adc_prescaler;
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to select the ADC Result Resolution. The default is @ref: ADC_RESOLUTION_10_BITS
+ * @note:  The 8 Bits results are returned in the range 0 to 255 by all the read functions.
+ * 
+ * @param[in] enum_adc_resolution:  The ADC Result Resolution.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid resolution.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_resolution(enum_adc_resolution_type enum_adc_resolution)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if(enum_adc_resolution < ADC_RESOLUTION_INVALID)
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                if(enum_adc_resolution == ADC_RESOLUTION_8_BITS)
+                {
+                    SET_BIT(REG_ADMUX, ADLAR);
+                }
+                else
+                {
+                    CLEAR_BIT(REG_ADMUX, ADLAR);
+                }
+                genum_adc_resolution = enum_adc_resolution;
+                update_millivolts_scales();
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to get the nominal free running sample rate of the current prescaler. Each conversion takes 13 ADC Clock Cycles.
+ *         Ex: @ 16 MHz: Prescaler 128 gives 9615 Samples/Second and Prescaler 32 gives 38461 Samples/Second.
+ * @note:  The rate is calculated from F_CPU and the ADPS Bits. It's not measured. The samples that are really delivered may be less:
+ *         The first conversion takes 25 ADC Clock Cycles, The other Auto Trigger sources start a conversion on their own events only,
+ *         and a sample is overwritten in case that the Conversion Complete Interrupt is not served within one conversion.
+ * 
+ * @param[out] puint32_samples_per_second:  Address of a variable in which the sample rate will be stored.
+ * @return sint32_type:                     SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: puint32_samples_per_second is NULL_POINTER
+ */
+sint32_type adc_get_nominal_sample_rate(uint32_type* puint32_samples_per_second)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    uint8_type  uint8_prescaler_bits = 0;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if(puint32_samples_per_second != NULL_PTR)
+        {
+            /*The ADPS2:0 Bits select a division factor of 2^ADPS. The value 0 divides by 2 too.*/
+            uint8_prescaler_bits = REG_ADCSRA & REG_ADCSRA_3_BITS_MASK;
+            if(uint8_prescaler_bits == 0)
+            {
+                uint8_prescaler_bits = ADC_PRESCALER_2;
+            }
+            *puint32_samples_per_second = (F_CPU >> uint8_prescaler_bits) / ADC_CLOCK_CYCLES_PER_CONVERSION;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to select the ADC Voltage Reference. The default is @ref: ADC_REFERENCE_AVCC
+ * @note:  The first conversions after changing the reference may be inaccurate until the AREF capacitor settles.
+ * 
+ * @param[in] enum_adc_reference:   The ADC Voltage Reference.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid reference.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_reference(enum_adc_reference_type enum_adc_reference)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if( (enum_adc_reference == ADC_REFERENCE_AREF) ||
+            (enum_adc_reference == ADC_REFERENCE_AVCC) ||
+            (enum_adc_reference == ADC_REFERENCE_INTERNAL_2_56V))
+        {
+            if(genum_adc_isr_mode == ADC_ISR_MODE_NONE)
+            {
+                REG_ADMUX = (uint8_type)(enum_adc_reference << REFS0) | (REG_ADMUX & REG_ADMUX_6_BITS_MASK);
+                genum_adc_reference = enum_adc_reference;
+                update_millivolts_scales();
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to store the calibration of a single ended channel in the EEPROM and to apply it.
+ *         The calibration table is loaded from the EEPROM by @ref: adc_init. An erased entry is loaded as offset 0 and gain 1.0.
+ * @note:  This function waits for the EEPROM writes. (About 8.5 ms per Byte)
+ * 
+ * @param[in] uint8_channel:            The single ended channel. (0 to 7)
+ * @param[in] pstr_adc_calibration:     Address of the calibration of the channel.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ */
+sint32_type adc_set_calibration(uint8_type uint8_channel, const struct_adc_calibration_type* pstr_adc_calibration)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint16_type uint16_address  = 0;
+    uint16_type uint16_offset   = 0;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        /*The Gain 0xFFFF is reserved for the erased EEPROM.*/
+        if( (uint8_channel < ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS) && (pstr_adc_calibration != NULL_PTR) &&
+            (pstr_adc_calibration->uint16_gain_q15 != ADC_EEPROM_ERASED_WORD))
+        {
+            uint16_address  = ADC_CALIBRATION_EEPROM_ADDRESS + ((uint16_type)uint8_channel * ADC_CALIBRATION_BYTES_PER_CHANNEL);
+            uint16_offset   = (uint16_type)pstr_adc_calibration->sint16_offset;
+            write_eeprom_byte(uint16_address,       (uint8_type)(uint16_offset));
+            write_eeprom_byte(uint16_address + 1,   (uint8_type)(uint16_offset >> 8));
+            write_eeprom_byte(uint16_address + 2,   (uint8_type)(pstr_adc_calibration->uint16_gain_q15));
+            write_eeprom_byte(uint16_address + 3,   (uint8_type)(pstr_adc_calibration->uint16_gain_q15 >> 8));
+
+            garr_str_calibration[uint8_channel] = *pstr_adc_calibration;
+            update_millivolts_scales();
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to convert a raw result of a single ended channel to milli volts.
+ *         The calibration, the reference, the resolution and the oversampling are folded in a Q16 scale of each channel when they change.
+ *         So the conversion is a subtraction, a multiplication and a shift only.
+ * 
+ * @param[in]  uint8_channel:           The single ended channel (0 to 7) that the raw result belongs to.
+ * @param[in]  uint16_raw_value:        The raw result as returned by the read functions.
+ * @param[out] pu16_millivolts:         Address of a variable in which the milli volts will be stored.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ */
+sint32_type adc_convert_to_millivolts(uint8_type uint8_channel, uint16_type uint16_raw_value, uint16_type* pu16_millivolts)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    sint32_type sint32_corrected    = 0;
+    uint32_type uint32_millivolts   = 0;
+    if(guint8_is_module_initialized == ADC_TRUE)
+    {
+        if((uint8_channel < ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS) && (pu16_millivolts != NULL_PTR))
+        {
+            sint32_corrected = (sint32_type)uint16_raw_value - garr_sint16_scaled_offset[uint8_channel];
+            if(sint32_corrected < 0)
+            {
+                sint32_corrected = 0;
+            }
+            uint32_millivolts = ((uint32_type)sint32_corrected * garr_uint32_millivolts_scale_q16[uint8_channel]) >> ADC_MILLIVOLTS_SCALE_SHIFT;
+            if(uint32_millivolts > ADC_MAX_MILLIVOLTS)
+            {
+                uint32_millivolts = ADC_MAX_MILLIVOLTS;
+            }
+            *pu16_millivolts = (uint16_type)uint32_millivolts;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
@@ -3,6 +3,119 @@
 
 #include "types.h"
 
+/*Number of samples in the free running ring buffer. This shall be a power of 2 and shall not exceed 128.*/
+#ifndef ADC_RING_BUFFER_SIZE
+#define ADC_RING_BUFFER_SIZE        32
+#endif
+
+/*Voltage on the AREF Pin and on the AVCC Pin in milli volts. Used by the millivolt conversion only.*/
+#ifndef ADC_AREF_MILLIVOLTS
+#define ADC_AREF_MILLIVOLTS         5000
+#endif
+
+#ifndef ADC_AVCC_MILLIVOLTS
+#define ADC_AVCC_MILLIVOLTS         5000
+#endif
+
+/*EEPROM Address of the calibration table. Each single ended channel takes 4 Bytes. (Offset then Gain, Little Endian)*/
+#ifndef ADC_CALIBRATION_EEPROM_ADDRESS
+#define ADC_CALIBRATION_EEPROM_ADDRESS      0x0000
+#endif
+
+#define ADC_NUMBER_OF_SINGLE_ENDED_CHANNELS 8
+#define ADC_CALIBRATION_GAIN_ONE            32768   /*1.0 in Q15*/
+
+/*Maximum Number of entries in the scan sequencer list.*/
+#ifndef ADC_SCAN_MAX_CHANNELS
+#define ADC_SCAN_MAX_CHANNELS       8
+#endif
+
+/**
+ * @enum:   enum_adc_trigger_source_type
+ * @brief:  Enumeration of the Auto Trigger Sources of the ADC. The values are the ADTS2:0 Bits in the SFIOR Register.
+ */
+typedef enum
+{
+    ADC_TRIGGER_FREE_RUNNING = 0,
+    ADC_TRIGGER_ANALOG_COMPARATOR,
+    ADC_TRIGGER_EXTERNAL_INTERRUPT_0,
+    ADC_TRIGGER_TIMER_0_COMPARE_MATCH,
+    ADC_TRIGGER_TIMER_0_OVERFLOW,
+    ADC_TRIGGER_TIMER_1_COMPARE_MATCH_B,
+    ADC_TRIGGER_TIMER_1_OVERFLOW,
+    ADC_TRIGGER_TIMER_1_CAPTURE_EVENT,
+    ADC_TRIGGER_INVALID
+}enum_adc_trigger_source_type;
+
+/**
+ * @enum:   enum_adc_prescaler_type
+ * @brief:  Enumeration of the ADC Clock Prescalers. The values are the ADPS2:0 Bits in the ADCSRA Register.
+ *          The full 10 Bits accuracy needs an ADC Clock from 50 KHz to 200 KHz. (Prescaler 128 @ 16 MHz)
+ *          The 8 Bits resolution is still accurate up to about 1 MHz ADC Clock. (Prescaler 16 or 32 @ 16 MHz)
+ */
+typedef enum
+{
+    ADC_PRESCALER_2 = 1,
+    ADC_PRESCALER_4,
+    ADC_PRESCALER_8,
+    ADC_PRESCALER_16,
+    ADC_PRESCALER_32,
+    ADC_PRESCALER_64,
+    ADC_PRESCALER_128,
+    ADC_PRESCALER_INVALID
+}enum_adc_prescaler_type;
+
+/**
+ * @enum:   enum_adc_resolution_type
+ * @brief:  Enumeration of the ADC Result Resolutions.
+ *          The 8 Bits resolution left adjusts the result (ADLAR) and reads the ADCH Register only.
+ */
+typedef enum
+{
+    ADC_RESOLUTION_10_BITS = 0,
+    ADC_RESOLUTION_8_BITS,
+    ADC_RESOLUTION_INVALID
+}enum_adc_resolution_type;
+
+/**
+ * @enum:   enum_adc_reference_type
+ * @brief:  Enumeration of the ADC Voltage References. The values are the REFS1:0 Bits in the ADMUX Register.
+ * @note:   Don't select the AVCC or the Internal Reference while an external voltage is applied on the AREF Pin.
+ */
+typedef enum
+{
+    ADC_REFERENCE_AREF = 0,
+    ADC_REFERENCE_AVCC,
+    ADC_REFERENCE_INTERNAL_2_56V = 3,
+    ADC_REFERENCE_INVALID
+}enum_adc_reference_type;
+
+/**
+ * @struct: struct_adc_calibration_type
+ * @brief:  Calibration of one single ended channel. corrected = (raw - offset) * gain.
+ */
+typedef struct
+{
+    sint16_type     sint16_offset;      /*Offset in 10 Bits LSBs. It's scaled internally to the selected resolution and oversampling.*/
+    uint16_type     uint16_gain_q15;    /*Gain in Q15. @ref: ADC_CALIBRATION_GAIN_ONE is a gain of 1.0. The Maximum is just under 2.0*/
+}struct_adc_calibration_type;
+
+/**
+ * @typedef:    pointer_func_adc_block_callback_type
+ * @brief:      Defining of the type of the Block Complete callback. It's called from the ADC ISR with the full block.
+ */
+typedef void (*pointer_func_adc_block_callback_type)(uint16_type* pu16_block, uint16_type uint16_block_length);
+
+/**
+ * @struct: struct_adc_scan_result_type
+ * @brief:  Structure that holds the latest result of one entry in the scan sequencer list.
+ */
+typedef struct
+{
+    uint16_type     uint16_value;
+    uint32_type     uint32_timestamp;   /*Index of the conversion since @ref: adc_start_scan. Each conversion takes 13 ADC Clock Cycles.*/
+}struct_adc_scan_result_type;
+
 /**
  * @brief: Function used to initialize the adc peripheral. 
  * 
@@ -39,4 +152,224 @@ sint32_type adc_disable(void);
  */
 sint32_type adc_read_value(uint16_type* pu16_adc_value);
 
+/**
+ * @brief: Function that is used to read the value of a conversion done in the ADC Noise Reduction sleep mode.
+ *         The CPU and the I/O clocks are stopped during the conversion. So the result has less noise and the CPU doesn't consume power while waiting.
+ * @note:  The Global Interrupts are enabled while sleeping. The timers clocked by the I/O clock stop during the conversion.
+ * 
+ * @param[in] pu16_adc_value:   Address of a variable in which the value will be stored.
+ * @return sint32_type:         SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: pu16_adc_value is NULL_POINTER 
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_read_value_quiet(uint16_type* pu16_adc_value);
+
+/**
+ * @brief: Function that is used to start the free running conversions on a specific channel.
+ *         Each conversion result is pushed by the ADC Conversion Complete ISR inside a ring buffer of @ref: ADC_RING_BUFFER_SIZE samples.
+ *         The Application shall drain it using @ref: adc_read_samples
+ * 
+ * @param[in] uint8_channel:    The MUX Channel to convert.
+ * @return sint32_type:         SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid channel.
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_start_free_running(uint8_type uint8_channel);
+
+/**
+ * @brief: Function that is used to stop the free running conversions. (Ring Buffer, Block Acquisition or Scan Sequencer)
+ * @note:  The samples that are still in the ring buffer can be drained after stopping.
+ * 
+ * @return sint32_type: SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ */
+sint32_type adc_stop_free_running(void);
+
+/**
+ * @brief: Function that is used to drain a batch of samples from the ring buffer filled by the free running conversions.
+ * 
+ * @param[out] pu16_samples:            Address of the array in which the samples will be stored.
+ * @param[in]  uint8_max_samples:       The Maximum Number of samples the array can hold.
+ * @param[out] puint8_samples_read:     Address of a variable in which the number of the copied samples will be stored.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success. (Including the case of empty ring buffer)
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of NULL_PTR arguments.
+ */
+sint32_type adc_read_samples(uint16_type* pu16_samples, uint8_type uint8_max_samples, uint8_type* puint8_samples_read);
+
+/**
+ * @brief: Function that is used to get the number of samples dropped because the ring buffer was full or the block was not released in time.
+ * 
+ * @param[out] pu16_dropped_samples:    Address of a variable in which the counter will be stored. The counter saturates at 0xFFFF.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: pu16_dropped_samples is NULL_POINTER
+ */
+sint32_type adc_get_dropped_samples(uint16_type* pu16_dropped_samples);
+
+/**
+ * @brief: Function that is used to start the double buffered block acquisition on a specific channel.
+ *         The ADC Conversion Complete ISR fills one block while the application processes the other one.
+ *         When a block is full the ISR switches to the other block and calls the callback with the full block.
+ *         The Application shall call @ref: adc_release_block when it finishes processing the block. (Inside the callback or later from the main loop)
+ * @note:  If the ISR fills a block while the other one is still not released, the filled block is dropped and refilled.
+ *         Its samples are added to the counter of @ref: adc_get_dropped_samples. So the released block is never overwritten.
+ *         The acquisition is stopped by @ref: adc_stop_free_running
+ * 
+ * @param[in] uint8_channel:                The MUX Channel to convert.
+ * @param[in] pu16_block_a:                 Address of the first block.
+ * @param[in] pu16_block_b:                 Address of the second block.
+ * @param[in] uint16_block_length:          Number of samples in each block.
+ * @param[in] pointer_func_block_callback:  The function called from the ISR with each full block.
+ * @return sint32_type:                     SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_start_block_acquisition(uint8_type uint8_channel, uint16_type* pu16_block_a, uint16_type* pu16_block_b, uint16_type uint16_block_length, pointer_func_adc_block_callback_type pointer_func_block_callback);
+
+/**
+ * @brief: Function that is used to give the last full block back to the ISR after processing it.
+ * 
+ * @return sint32_type: SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ */
+sint32_type adc_release_block(void);
+
+/**
+ * @brief: Function that is used to start the scan sequencer over a list of MUX codes in free running mode.
+ *         The ADMUX is rotated inside the Conversion Complete ISR while the next conversion is already running. So there is no throwaway conversion on each channel switch.
+ *         The latest result of each list entry is stored with its conversion index as a timestamp.
+ * @note:  The first result of the first entry is converted twice after the start. The first conversion after switching to a differential gain channel may be less accurate.
+ * 
+ * @param[in] puint8_mux_codes:         Address of the array of the MUX codes (Single ended channels 0x00-0x07 or Differential/Gain codes 0x08-0x1F).
+ * @param[in] uint8_number_of_channels: Number of entries in the array. @note: This shall be less than or equal to @ref: ADC_SCAN_MAX_CHANNELS
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ *                      ERROR_MODULE_BUSY in case that another acquisition is running.
+ */
+sint32_type adc_start_scan(const uint8_type* puint8_mux_codes, uint8_type uint8_number_of_channels);
+
+/**
+ * @brief: Function that is used to get the latest result of a specific entry in the scan list.
+ * 
+ * @param[in]  uint8_slot_index:    Index of the entry inside the list passed to @ref: adc_start_scan
+ * @param[out] pstr_scan_result:    Address of a structure in which the result and its timestamp will be stored.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ */
+sint32_type adc_get_scan_result(uint8_type uint8_slot_index, struct_adc_scan_result_type* pstr_scan_result);
+
+/**
+ * @brief: Function that is used to select the Auto Trigger Source of the interrupt driven conversions. (ADTS Bits)
+ *         Using a timer as a trigger source gives fixed and jitter-free sample intervals.
+ *         Example: Timer 0 in TIMER_MODE_CTC with TIMER_8_PRESCALAR and compare value 199 triggers the ADC at F_CPU / (8 * 200) = 10 KHz @ 16 MHz.
+ * @note:  The trigger flag is cleared inside the ADC ISR. So the timer interrupt doesn't need to be enabled (TIMER_USAGE_POLLING can be used).
+ *         The conversion time (13 ADC Clock Cycles) shall be less than the trigger period.
+ *         The new source is applied on the next call to @ref: adc_start_free_running or @ref: adc_start_scan.
+ * 
+ * @param[in] enum_adc_trigger_source:  The Required Trigger Source.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid trigger source.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_trigger_source(enum_adc_trigger_source_type enum_adc_trigger_source);
+
+/**
+ * @brief: Function that is used to configure the oversampling and decimation inside the ADC ISR.
+ *         4^n conversions are accumulated for each output sample. Then the sum is shifted right n bits. So the output sample has (resolution + n) bits: 10 + n with @ref: ADC_RESOLUTION_10_BITS and 8 + n with @ref: ADC_RESOLUTION_8_BITS.
+ *         The output sample rate is the conversion rate divided by 4^n.
+ * @note:  The extra resolution is real only when the input has about 1 LSB of (white) noise. A clean and stable input gives the same code on each conversion.
+ *         In that case add dither: Ex: a triangular signal of 1-2 LSB peak to peak summed on the input through a high value resistor from a PWM pin and an RC filter.
+ *         The dither period shall be a multiple of the 4^n samples window so it averages out.
+ *         The Decimation is applied to @ref: adc_start_free_running and @ref: adc_start_block_acquisition only.
+ * 
+ * @param[in] uint8_extra_bits:     The number of extra bits (n). 0 disables the oversampling. @note: This shall not exceed 3
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid number of bits.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_oversampling(uint8_type uint8_extra_bits);
+
+/**
+ * @brief: Function that is used to select the ADC Clock Prescaler. The default is @ref: ADC_PRESCALER_128
+ * 
+ * @param[in] enum_adc_prescaler:   The ADC Clock Prescaler.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid prescaler.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_prescaler(enum_adc_prescaler_type enum_adc_prescaler);
+
+/**
+ * @brief: Function that is used to select the ADC Result Resolution. The default is @ref: ADC_RESOLUTION_10_BITS
+ * @note:  The 8 Bits results are returned in the range 0 to 255 by all the read functions.
+ * 
+ * @param[in] enum_adc_resolution:  The ADC Result Resolution.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid resolution.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_resolution(enum_adc_resolution_type enum_adc_resolution);
+
+/**
+ * @brief: Function that is used to get the nominal free running sample rate of the current prescaler. Each conversion takes 13 ADC Clock Cycles.
+ *         Ex: @ 16 MHz: Prescaler 128 gives 9615 Samples/Second and Prescaler 32 gives 38461 Samples/Second.
+ * @note:  The rate is calculated from F_CPU and the ADPS Bits. It's not measured. The samples that are really delivered may be less:
+ *         The first conversion takes 25 ADC Clock Cycles, The other Auto Trigger sources start a conversion on their own events only,
+ *         and a sample is overwritten in case that the Conversion Complete Interrupt is not served within one conversion.
+ * 
+ * @param[out] puint32_samples_per_second:  Address of a variable in which the sample rate will be stored.
+ * @return sint32_type:                     SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: puint32_samples_per_second is NULL_POINTER
+ */
+sint32_type adc_get_nominal_sample_rate(uint32_type* puint32_samples_per_second);
+
+/**
+ * @brief: Function that is used to select the ADC Voltage Reference. The default is @ref: ADC_REFERENCE_AVCC
+ * @note:  The first conversions after changing the reference may be inaccurate until the AREF capacitor settles.
+ * 
+ * @param[in] enum_adc_reference:   The ADC Voltage Reference.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid reference.
+ *                      ERROR_MODULE_BUSY in case that an acquisition is running.
+ */
+sint32_type adc_set_reference(enum_adc_reference_type enum_adc_reference);
+
+/**
+ * @brief: Function that is used to store the calibration of a single ended channel in the EEPROM and to apply it.
+ *         The calibration table is loaded from the EEPROM by @ref: adc_init. An erased entry is loaded as offset 0 and gain 1.0.
+ * @note:  This function waits for the EEPROM writes. (About 8.5 ms per Byte)
+ * 
+ * @param[in] uint8_channel:            The single ended channel. (0 to 7)
+ * @param[in] pstr_adc_calibration:     Address of the calibration of the channel.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ */
+sint32_type adc_set_calibration(uint8_type uint8_channel, const struct_adc_calibration_type* pstr_adc_calibration);
+
+/**
+ * @brief: Function that is used to convert a raw result of a single ended channel to milli volts.
+ *         The calibration, the reference, the resolution and the oversampling are folded in a Q16 scale of each channel when they change.
+ *         So the conversion is a subtraction, a multiplication and a shift only.
+ * 
+ * @param[in]  uint8_channel:           The single ended channel (0 to 7) that the raw result belongs to.
+ * @param[in]  uint16_raw_value:        The raw result as returned by the read functions.
+ * @param[out] pu16_millivolts:         Address of a variable in which the milli volts will be stored.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: adc_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid arguments.
+ */
+sint32_type adc_convert_to_millivolts(uint8_type uint8_channel, uint16_type uint16_raw_value, uint16_type* pu16_millivolts);
+
 #endif  /*__ADC_H__*/
\ No newline at end of file
@@ -21,6 +21,7 @@
 #define REG_TWAR           	(*((volatile uint8_type*) 0x22)) 
 #define REG_TWDR           	(*((volatile uint8_type*) 0x23)) 
 #define REG_ADC           	(*((volatile uint16_type*) 0x24)) 
+#define REG_ADCH            (*((volatile uint8_type*) 0x25)) /*High Byte of the ADC Data Register. Holds the 8 MSBs when ADLAR is set*/
 #define REG_ADCSRA          (*((volatile uint8_type*) 0x26)) 
 #define REG_ADMUX           (*((volatile uint8_type*) 0x27)) 
 #define REG_ACSR           	(*((volatile uint8_type*) 0x28)) 
@@ -56,6 +57,7 @@
 #define REG_TCCR2          	(*((volatile uint8_type*) 0x45)) 
 #define REG_ICR1L           (*((volatile uint8_type*) 0x46)) 
 #define REG_ICR1H           (*((volatile uint8_type*) 0x47)) 
+#define REG_ICR1            (*((volatile uint16_type*) 0x46)) /*16 Bits access to ICR1H:ICR1L*/
 #define REG_OCR1B           (*((volatile uint16_type*) 0x48)) 
 #define REG_OCR1A           (*((volatile uint16_type*) 0x4A)) 
 #define REG_TCNT1           (*((volatile uint16_type*) 0x4C)) 
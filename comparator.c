@@ -0,0 +1,200 @@
+/**
+ * @file:       comparator.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Analog Comparator Driver.
+ * @version:    1.0
+ * @date:       2022-08-24
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "comparator.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+#include "gpio.h"
+#include <avr/interrupt.h>
+
+#define COMPARATOR_FALSE            0
+#define COMPARATOR_TRUE             1
+
+#define ACIS0_BIT                   0   /*Bit Index inside the REG_ACSR*/
+#define ACIC_BIT                    2   /*Bit Index inside the REG_ACSR*/
+#define ACIE_BIT                    3   /*Bit Index inside the REG_ACSR*/
+#define ACI_BIT                     4   /*Bit Index inside the REG_ACSR*/
+#define ACO_BIT                     5   /*Bit Index inside the REG_ACSR*/
+#define ACBG_BIT                    6   /*Bit Index inside the REG_ACSR*/
+#define ACD_BIT                     7   /*Bit Index inside the REG_ACSR*/
+#define ACME_BIT                    3   /*Bit Index inside the REG_SFIOR*/
+#define ADEN_BIT                    7   /*Bit Index inside the REG_ADCSRA*/
+#define I_BIT                       7   /*Bit Index inside the REG_SREG*/
+
+#define COMPARATOR_AIN_PORT         ENU_PORT_B
+#define COMPARATOR_AIN0_PIN         2
+#define COMPARATOR_AIN1_PIN         3
+#define COMPARATOR_ADC_PORT         ENU_PORT_A
+
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_ADMUX_MUX_2_0_MASK
+ *
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| 0     | 0     | 0     | 0     | 0     | 1     |  1    | 1     |
+|---------------------------------------------------------------|
+*/
+#define REG_ADMUX_MUX_2_0_MASK      0x07
+
+static uint8_type                               guint8_is_module_initialized        = COMPARATOR_FALSE;
+static pointer_func_comparator_callback_type    gpointer_func_comparator_callback   = NULL_PTR;
+
+ISR(ANA_COMP_vect)
+{
+    /*The ACI Flag is cleared by the hardware when the vector is executed.*/
+    if(gpointer_func_comparator_callback != NULL_PTR)
+    {
+        gpointer_func_comparator_callback(GET_BIT(REG_ACSR, ACO_BIT));
+    }
+}
+
+/**
+ * @brief: Function that is used to initialize and enable the Analog Comparator.
+ *         The Comparator detects the threshold crossing in hardware. The Interrupt is raised within a few cycles of the edge without polling the ADC.
+ * @note:  The Interrupt is disabled while the inputs and the edge are changed. Then any flag raised by the change is cleared before enabling it.
+ *
+ * @param[in] pstr_comparator_config:   Address of the Comparator Configurations.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid configurations.
+ *                      ERROR_MODULE_BUSY in case that an ADC Channel is selected as Negative Input while the ADC is enabled.
+ */
+sint32_type comparator_init(const struct_comparator_config_type* pstr_comparator_config)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_acsr      = 0;
+    if  (
+            (pstr_comparator_config != NULL_PTR) &&
+            (pstr_comparator_config->enum_comparator_positive_input < COMPARATOR_POSITIVE_INPUT_INVALID) &&
+            (pstr_comparator_config->enum_comparator_negative_input < COMPARATOR_NEGATIVE_INPUT_INVALID) &&
+            (
+                (pstr_comparator_config->enum_comparator_interrupt_mode == COMPARATOR_INTERRUPT_ON_TOGGLE) ||
+                (pstr_comparator_config->enum_comparator_interrupt_mode == COMPARATOR_INTERRUPT_ON_FALLING_EDGE) ||
+                (pstr_comparator_config->enum_comparator_interrupt_mode == COMPARATOR_INTERRUPT_ON_RISING_EDGE)
+            )
+        )
+    {
+        if((pstr_comparator_config->enum_comparator_negative_input != COMPARATOR_NEGATIVE_INPUT_AIN1) && (GET_BIT(REG_ADCSRA, ADEN_BIT) != 0))
+        {
+            /*The ADC Multiplexer can't be used by the Comparator while the ADC converts.*/
+            sint32_retval = ERROR_MODULE_BUSY;
+        }
+        else
+        {
+            /*Disable the Interrupt first. Changing the inputs or the edge may raise a false interrupt.*/
+            CLEAR_BIT(REG_ACSR, ACIE_BIT);
+
+            /*Positive Input*/
+            if(pstr_comparator_config->enum_comparator_positive_input == COMPARATOR_POSITIVE_INPUT_BANDGAP)
+            {
+                SET_BIT(uint8_acsr, ACBG_BIT);
+            }
+            else
+            {
+                gpio_set_pin_direction(COMPARATOR_AIN_PORT, COMPARATOR_AIN0_PIN, ENU_DIRECTION_INPUT);
+            }
+
+            /*Negative Input*/
+            if(pstr_comparator_config->enum_comparator_negative_input == COMPARATOR_NEGATIVE_INPUT_AIN1)
+            {
+                CLEAR_BIT(REG_SFIOR, ACME_BIT);
+                gpio_set_pin_direction(COMPARATOR_AIN_PORT, COMPARATOR_AIN1_PIN, ENU_DIRECTION_INPUT);
+            }
+            else
+            {
+                uint8_type uint8_adc_channel = (uint8_type)(pstr_comparator_config->enum_comparator_negative_input - COMPARATOR_NEGATIVE_INPUT_ADC0);
+                REG_ADMUX = uint8_adc_channel | (REG_ADMUX & (uint8_type)(~REG_ADMUX_MUX_2_0_MASK));
+                SET_BIT(REG_SFIOR, ACME_BIT);
+                gpio_set_pin_direction(COMPARATOR_ADC_PORT, uint8_adc_channel, ENU_DIRECTION_INPUT);
+            }
+
+            /*Timer 1 Input Capture Trigger*/
+            if(pstr_comparator_config->uint8_is_input_capture_enabled == TRUE)
+            {
+                SET_BIT(uint8_acsr, ACIC_BIT);
+            }
+
+            /*Edge Selection. The ACD is written as 0 to enable the Comparator.*/
+            uint8_acsr |= (uint8_type)(pstr_comparator_config->enum_comparator_interrupt_mode << ACIS0_BIT);
+            REG_ACSR = uint8_acsr;
+
+            /*Clear the flag raised by the change then enable the Interrupt if needed.*/
+            REG_ACSR = uint8_acsr | (1<<ACI_BIT);
+            gpointer_func_comparator_callback = pstr_comparator_config->pointer_func_comparator_callback;
+            if(gpointer_func_comparator_callback != NULL_PTR)
+            {
+                REG_ACSR = uint8_acsr | (1<<ACIE_BIT);
+                SET_BIT(REG_SREG, I_BIT);
+            }
+
+            guint8_is_module_initialized = COMPARATOR_TRUE;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to disable the Analog Comparator to save power.
+ *
+ * @return sint32_type: SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: comparator_init before.
+ */
+sint32_type comparator_deinit(void)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == COMPARATOR_TRUE)
+    {
+        /*The Interrupt shall be disabled before switching the Comparator off. Otherwise an interrupt can occur on the change.*/
+        CLEAR_BIT(REG_ACSR, ACIE_BIT);
+        REG_ACSR = (1<<ACD_BIT) | (1<<ACI_BIT);
+        CLEAR_BIT(REG_SFIOR, ACME_BIT);
+        gpointer_func_comparator_callback   = NULL_PTR;
+        guint8_is_module_initialized        = COMPARATOR_FALSE;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief: Function that is used to read the Analog Comparator Output.
+ *
+ * @param[out] puint8_output_level: Address of a variable in which the Output will be stored. 1 when the Positive Input is higher than the Negative Input.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: comparator_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: puint8_output_level is NULL_POINTER
+ */
+sint32_type comparator_get_output(uint8_type* puint8_output_level)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == COMPARATOR_TRUE)
+    {
+        if(puint8_output_level != NULL_PTR)
+        {
+            *puint8_output_level = GET_BIT(REG_ACSR, ACO_BIT);
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
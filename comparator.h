@@ -0,0 +1,104 @@
+/**
+ * @file:   comparator.h
+ * @brief:  File Contains all the needed types and API(s) Prototypes of the Analog Comparator Driver.
+ * @author: Mina Raouf
+ *
+ */
+
+#ifndef __COMPARATOR_H__
+#define __COMPARATOR_H__
+
+#include "types.h"
+
+/**
+ * @enum:   enum_comparator_positive_input_type
+ * @brief:  Enumeration of the Positive Inputs of the Analog Comparator.
+ */
+typedef enum
+{
+    COMPARATOR_POSITIVE_INPUT_AIN0 = 0,         /*PB2 Pin*/
+    COMPARATOR_POSITIVE_INPUT_BANDGAP,          /*Internal Bandgap Reference. (About 1.22 V)*/
+    COMPARATOR_POSITIVE_INPUT_INVALID
+}enum_comparator_positive_input_type;
+
+/**
+ * @enum:   enum_comparator_negative_input_type
+ * @brief:  Enumeration of the Negative Inputs of the Analog Comparator.
+ * @note:   The ADC Channels are selected through the ADC Multiplexer. So the ADC shall be disabled while they are used.
+ */
+typedef enum
+{
+    COMPARATOR_NEGATIVE_INPUT_AIN1 = 0,         /*PB3 Pin*/
+    COMPARATOR_NEGATIVE_INPUT_ADC0,
+    COMPARATOR_NEGATIVE_INPUT_ADC1,
+    COMPARATOR_NEGATIVE_INPUT_ADC2,
+    COMPARATOR_NEGATIVE_INPUT_ADC3,
+    COMPARATOR_NEGATIVE_INPUT_ADC4,
+    COMPARATOR_NEGATIVE_INPUT_ADC5,
+    COMPARATOR_NEGATIVE_INPUT_ADC6,
+    COMPARATOR_NEGATIVE_INPUT_ADC7,
+    COMPARATOR_NEGATIVE_INPUT_INVALID
+}enum_comparator_negative_input_type;
+
+/**
+ * @enum:   enum_comparator_interrupt_mode_type
+ * @brief:  Enumeration of the Output Edges that raise the Analog Comparator Interrupt. The values are the ACIS1:0 Bits in the ACSR Register.
+ */
+typedef enum
+{
+    COMPARATOR_INTERRUPT_ON_TOGGLE = 0,
+    COMPARATOR_INTERRUPT_ON_FALLING_EDGE = 2,   /*The Positive Input falls below the Negative Input*/
+    COMPARATOR_INTERRUPT_ON_RISING_EDGE,        /*The Positive Input rises above the Negative Input*/
+    COMPARATOR_INTERRUPT_INVALID
+}enum_comparator_interrupt_mode_type;
+
+/**
+ * @typedef:    pointer_func_comparator_callback_type
+ * @brief:      Defining of the type of the Analog Comparator callback. It's called from the ISR with the Comparator Output level after the edge.
+ */
+typedef void (*pointer_func_comparator_callback_type)(uint8_type uint8_output_level);
+
+/**
+ * @struct: struct_comparator_config_type
+ * @brief:  Configurations of the Analog Comparator.
+ */
+typedef struct
+{
+    enum_comparator_positive_input_type     enum_comparator_positive_input;
+    enum_comparator_negative_input_type     enum_comparator_negative_input;
+    enum_comparator_interrupt_mode_type     enum_comparator_interrupt_mode;
+    uint8_type                              uint8_is_input_capture_enabled;     /*TRUE: The Comparator Output triggers the Timer 1 Input Capture instead of the ICP1 Pin.*/
+    pointer_func_comparator_callback_type   pointer_func_comparator_callback;   /*NULL_PTR: No Interrupt. The Output can be polled by @ref: comparator_get_output*/
+}struct_comparator_config_type;
+
+/**
+ * @brief: Function that is used to initialize and enable the Analog Comparator.
+ *         The Comparator detects the threshold crossing in hardware. The Interrupt is raised within a few cycles of the edge without polling the ADC.
+ * @note:  The Interrupt is disabled while the inputs and the edge are changed. Then any flag raised by the change is cleared before enabling it.
+ *
+ * @param[in] pstr_comparator_config:   Address of the Comparator Configurations.
+ * @return sint32_type:                 SUCCESS_RETVAL in case of success.
+ *                      ERROR_INVALID_ARGUMENTS in case of invalid configurations.
+ *                      ERROR_MODULE_BUSY in case that an ADC Channel is selected as Negative Input while the ADC is enabled.
+ */
+sint32_type comparator_init(const struct_comparator_config_type* pstr_comparator_config);
+
+/**
+ * @brief: Function that is used to disable the Analog Comparator to save power.
+ *
+ * @return sint32_type: SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: comparator_init before.
+ */
+sint32_type comparator_deinit(void);
+
+/**
+ * @brief: Function that is used to read the Analog Comparator Output.
+ *
+ * @param[out] puint8_output_level: Address of a variable in which the Output will be stored. 1 when the Positive Input is higher than the Negative Input.
+ * @return sint32_type:             SUCCESS_RETVAL in case of success.
+ *                      ERROR_MODULE_NOT_INITAILIZED in case of not call the @ref: comparator_init before.
+ *                      ERROR_INVALID_ARGUMENTS in case of that the @param: puint8_output_level is NULL_POINTER
+ */
+sint32_type comparator_get_output(uint8_type* puint8_output_level);
+
+#endif  /*__COMPARATOR_H__*/
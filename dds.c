@@ -0,0 +1,258 @@
+/**
+ * @file:       dds.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Direct Digital Synthesis (DDS) Waveform Generator on Timer 2.
+ * @version:    1.0
+ * @date:       2022-09-01
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "dds.h"
+#include "timer.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+#include <avr/pgmspace.h>
+
+#define DDS_FALSE                           0
+#define DDS_TRUE                            1
+
+#define I_BIT                               7   /*Bit Index inside the REG_SREG*/
+
+#define DDS_PHASE_BITS                      24
+/*The upper 8 Bits of the 24 Bits Phase index the table. The Bits above 24 are ignored. So the Phase wraps at 2^24.*/
+#define DDS_TABLE_INDEX_SHIFT               (DDS_PHASE_BITS - 8)
+#define DDS_MID_SCALE_DUTY_CYCLE            50
+
+/*One period of 128 + 127 * sin(2 * PI * i / 256)*/
+static const uint8_type garr_uint8_sine_table[DDS_WAVEFORM_TABLE_SIZE] PROGMEM =
+{
+    0x80, 0x83, 0x86, 0x89, 0x8C, 0x90, 0x93, 0x96, 0x99, 0x9C, 0x9F, 0xA2, 0xA5, 0xA8, 0xAB, 0xAE,
+    0xB1, 0xB3, 0xB6, 0xB9, 0xBC, 0xBF, 0xC1, 0xC4, 0xC7, 0xC9, 0xCC, 0xCE, 0xD1, 0xD3, 0xD5, 0xD8,
+    0xDA, 0xDC, 0xDE, 0xE0, 0xE2, 0xE4, 0xE6, 0xE8, 0xEA, 0xEB, 0xED, 0xEF, 0xF0, 0xF1, 0xF3, 0xF4,
+    0xF5, 0xF6, 0xF8, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0xFA, 0xFA, 0xF9, 0xF8, 0xF6,
+    0xF5, 0xF4, 0xF3, 0xF1, 0xF0, 0xEF, 0xED, 0xEB, 0xEA, 0xE8, 0xE6, 0xE4, 0xE2, 0xE0, 0xDE, 0xDC,
+    0xDA, 0xD8, 0xD5, 0xD3, 0xD1, 0xCE, 0xCC, 0xC9, 0xC7, 0xC4, 0xC1, 0xBF, 0xBC, 0xB9, 0xB6, 0xB3,
+    0xB1, 0xAE, 0xAB, 0xA8, 0xA5, 0xA2, 0x9F, 0x9C, 0x99, 0x96, 0x93, 0x90, 0x8C, 0x89, 0x86, 0x83,
+    0x80, 0x7D, 0x7A, 0x77, 0x74, 0x70, 0x6D, 0x6A, 0x67, 0x64, 0x61, 0x5E, 0x5B, 0x58, 0x55, 0x52,
+    0x4F, 0x4D, 0x4A, 0x47, 0x44, 0x41, 0x3F, 0x3C, 0x39, 0x37, 0x34, 0x32, 0x2F, 0x2D, 0x2B, 0x28,
+    0x26, 0x24, 0x22, 0x20, 0x1E, 0x1C, 0x1A, 0x18, 0x16, 0x15, 0x13, 0x11, 0x10, 0x0F, 0x0D, 0x0C,
+    0x0B, 0x0A, 0x08, 0x07, 0x06, 0x06, 0x05, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x15, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x20, 0x22, 0x24,
+    0x26, 0x28, 0x2B, 0x2D, 0x2F, 0x32, 0x34, 0x37, 0x39, 0x3C, 0x3F, 0x41, 0x44, 0x47, 0x4A, 0x4D,
+    0x4F, 0x52, 0x55, 0x58, 0x5B, 0x5E, 0x61, 0x64, 0x67, 0x6A, 0x6D, 0x70, 0x74, 0x77, 0x7A, 0x7D
+};
+
+static uint32_type                  guint32_phase_accumulator       = 0;
+static volatile uint32_type         guint32_tuning_word             = 0;
+static const uint8_type* volatile   gpuint8_waveform_table          = garr_uint8_sine_table;
+static uint8_type                   guint8_is_started               = DDS_FALSE;
+static uint8_type                   guint8_is_module_initialized    = DDS_FALSE;
+
+static void         dds_sample_callback(enum_timer_index_type enum_timer_index);
+static uint32_type  calculate_tuning_word(uint32_type uint32_frequency_in_millihertz);
+
+/**
+ * @brief:  Timer 2 Overflow callback. It's called from the ISR once per sample at BOTTOM.
+ *          OCR2 is double buffered in the PWM modes and updated at TOP. So the sample is output for the whole next period.
+ * @return  None
+ */
+static void dds_sample_callback(enum_timer_index_type enum_timer_index)
+{
+    (void)enum_timer_index;
+    guint32_phase_accumulator  += guint32_tuning_word;
+    REG_OCR2                    = pgm_read_byte(gpuint8_waveform_table + (uint8_type)(guint32_phase_accumulator >> DDS_TABLE_INDEX_SHIFT));
+}
+
+/**
+ * @brief:  Function that is used to calculate the Phase step of each sample. (frequency * 2^24 / Sample Rate)
+ *          It's a long division of one Bit per step. So the shifted frequency doesn't need 56 Bits.
+ * @note:   The frequency shall be less than the Sample Rate. So the remainder fits 26 Bits.
+ * @return  The Tuning Word rounded down. The error is less than one step of the frequency resolution.
+ */
+static uint32_type calculate_tuning_word(uint32_type uint32_frequency_in_millihertz)
+{
+    uint32_type uint32_tuning_word  = 0;
+    uint32_type uint32_remainder    = uint32_frequency_in_millihertz;
+    uint8_type  uint8_iterator      = 0;
+    for(uint8_iterator = 0; uint8_iterator < DDS_PHASE_BITS; uint8_iterator++)
+    {
+        uint32_remainder  <<= 1;
+        uint32_tuning_word <<= 1;
+        if(uint32_remainder >= DDS_SAMPLE_RATE_IN_MILLIHERTZ)
+        {
+            uint32_remainder   -= DDS_SAMPLE_RATE_IN_MILLIHERTZ;
+            uint32_tuning_word |= 1;
+        }
+    }
+    return uint32_tuning_word;
+}
+
+/**
+ * @brief:      Function that is used to initialize Timer 2 in TIMER_MODE_PHASE_PWM on the OC2 Pin. The generator is stopped and the Sine Waveform is selected.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              Or any error returned by @fn: timer_init on Timer 2. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 2 is used by another module)
+ */
+sint32_type dds_init(void)
+{
+    sint32_type         sint32_retval = SUCCESS_RETVAL;
+    tstr_timer_config   str_timer_config;
+
+    str_timer_config.enum_timer_index               = TIMER_INDEX_2;
+    str_timer_config.enum_timer_interrupt_usage     = TIMER_USAGE_INTERRUPT;
+    str_timer_config.enum_timer_mode                = TIMER_MODE_PHASE_PWM;
+    str_timer_config.enum_timer_prescalar_value     = TIMER_NO_PRESCALAR;
+    str_timer_config.pointer_func_timer_callback    = dds_sample_callback;
+    str_timer_config.enum_timer_pwm_resolution      = TIMER_PWM_RESOLUTION_8_BITS;
+    str_timer_config.enum_timer_clock_source        = TIMER_CLOCK_SOURCE_CPU;
+    sint32_retval = timer_init(&str_timer_config);
+    if(sint32_retval == SUCCESS_RETVAL)
+    {
+        /*The OC2 Pin is enabled at the mid scale. So the filtered output starts from the middle of the waveforms.*/
+        sint32_retval = timer_generate_pwm(TIMER_INDEX_2, DDS_MID_SCALE_DUTY_CYCLE);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            /*@fn: timer_generate_pwm starts the clock. It's stopped till @ref: dds_start.*/
+            sint32_retval = timer_disable(TIMER_INDEX_2);
+        }
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            guint32_phase_accumulator       = 0;
+            guint32_tuning_word             = 0;
+            gpuint8_waveform_table          = garr_uint8_sine_table;
+            guint8_is_started               = DDS_FALSE;
+            guint8_is_module_initialized    = DDS_TRUE;
+        }
+        else
+        {
+            timer_deinit(TIMER_INDEX_2);
+        }
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to select the Waveform. The change applies from the next sample.
+ *
+ * @param[in]   puint8_waveform_table:  Address of a table of DDS_WAVEFORM_TABLE_SIZE samples in the Flash. (Declared with PROGMEM) NULL_PTR selects the built in Sine.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_set_waveform(const uint8_type* puint8_waveform_table)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == DDS_TRUE)
+    {
+        if(puint8_waveform_table == NULL_PTR)
+        {
+            puint8_waveform_table = garr_uint8_sine_table;
+        }
+        /*The 16 Bits address is read by the ISR. So it's written with the interrupts disabled.*/
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        gpuint8_waveform_table = puint8_waveform_table;
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to set the output Frequency. The Phase Accumulator is not reset. So the output has no glitch on the change.
+ *
+ * @param[in]   uint32_frequency_in_millihertz:     The Frequency in Milli Hertz. @note: This shall be less than DDS_MAX_FREQUENCY_IN_MILLIHERTZ.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_set_frequency(uint32_type uint32_frequency_in_millihertz)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    uint32_type uint32_tuning_word  = 0;
+    uint8_type  uint8_sreg          = 0;
+    if(uint32_frequency_in_millihertz < DDS_MAX_FREQUENCY_IN_MILLIHERTZ)
+    {
+        if(guint8_is_module_initialized == DDS_TRUE)
+        {
+            /*The division is done before the interrupts are disabled. Only the 32 Bits copy is atomic.*/
+            uint32_tuning_word = calculate_tuning_word(uint32_frequency_in_millihertz);
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            guint32_tuning_word = uint32_tuning_word;
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to start the generator from the phase 0.
+ *
+ * @return      SUCCESS_RETVAL: In case of success, or the generator is already started.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_start(void)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == DDS_TRUE)
+    {
+        if(guint8_is_started == DDS_FALSE)
+        {
+            /*Timer 2 is stopped. So the ISR doesn't use the Phase Accumulator meanwhile.*/
+            guint32_phase_accumulator = 0;
+            sint32_retval = timer_enable(TIMER_INDEX_2);
+            if(sint32_retval == SUCCESS_RETVAL)
+            {
+                guint8_is_started = DDS_TRUE;
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to stop the generator. Timer 2 is stopped. So the ISR doesn't load the CPU.
+ * @note:       The OC2 Pin stays at the digital level (High or Low) it had when the timer stopped. It's not a PWM anymore.
+ *              So the filtered output doesn't hold the last sample. It drifts to 0 V or Vcc.
+ *
+ * @return      SUCCESS_RETVAL: In case of success, or the generator is already stopped.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_stop(void)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == DDS_TRUE)
+    {
+        if(guint8_is_started == DDS_TRUE)
+        {
+            sint32_retval = timer_disable(TIMER_INDEX_2);
+            guint8_is_started = DDS_FALSE;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
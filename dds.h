@@ -0,0 +1,73 @@
+/**
+ * @file:           dds.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration of the Direct Digital Synthesis (DDS) Waveform Generator.
+ *                  A 24 Bits Phase Accumulator is advanced in the Timer 2 Overflow ISR and its upper 8 Bits index a 256 samples Waveform Table in the Flash.
+ *                  The sample is written to OCR2. So an RC Low Pass Filter on the OC2 Pin (PD7) gives an analog output without a DAC.
+ * @note:           Timer 2 is owned by this module after @ref: dds_init. It runs in TIMER_MODE_PHASE_PWM without prescalar. (31.37 KHz Samples @ 16 MHz)
+ *                  The ISR takes about a quarter of the CPU while the generator is started.
+ */
+
+#ifndef __DDS_H__
+#define __DDS_H__
+
+#include "types.h"
+
+#ifndef F_CPU
+#define F_CPU                               16000000UL
+#endif
+
+/*The Phase Correct PWM counts up to 255 and down to 0. So one sample is 510 CPU Cycles.*/
+#define DDS_CYCLES_PER_SAMPLE               510UL
+/*The Sample Rate in Milli Hertz. It's split to keep F_CPU * 1000 out of 32 Bits.*/
+#define DDS_SAMPLE_RATE_IN_MILLIHERTZ       (((F_CPU / DDS_CYCLES_PER_SAMPLE) * 1000UL) + (((F_CPU % DDS_CYCLES_PER_SAMPLE) * 1000UL) / DDS_CYCLES_PER_SAMPLE))
+/*The highest frequency is half the Sample Rate. (15.68 KHz @ 16 MHz) The Frequency resolution is Sample Rate / 2^24. (1.87 Milli Hertz @ 16 MHz)*/
+#define DDS_MAX_FREQUENCY_IN_MILLIHERTZ     (DDS_SAMPLE_RATE_IN_MILLIHERTZ / 2)
+#define DDS_WAVEFORM_TABLE_SIZE             256
+
+/**
+ * @brief:      Function that is used to initialize Timer 2 in TIMER_MODE_PHASE_PWM on the OC2 Pin. The generator is stopped and the Sine Waveform is selected.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              Or any error returned by @fn: timer_init on Timer 2. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 2 is used by another module)
+ */
+sint32_type dds_init(void);
+
+/**
+ * @brief:      Function that is used to select the Waveform. The change applies from the next sample.
+ *
+ * @param[in]   puint8_waveform_table:  Address of a table of DDS_WAVEFORM_TABLE_SIZE samples in the Flash. (Declared with PROGMEM) NULL_PTR selects the built in Sine.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_set_waveform(const uint8_type* puint8_waveform_table);
+
+/**
+ * @brief:      Function that is used to set the output Frequency. The Phase Accumulator is not reset. So the output has no glitch on the change.
+ *
+ * @param[in]   uint32_frequency_in_millihertz:     The Frequency in Milli Hertz. @note: This shall be less than DDS_MAX_FREQUENCY_IN_MILLIHERTZ.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_set_frequency(uint32_type uint32_frequency_in_millihertz);
+
+/**
+ * @brief:      Function that is used to start the generator from the phase 0.
+ *
+ * @return      SUCCESS_RETVAL: In case of success, or the generator is already started.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_start(void);
+
+/**
+ * @brief:      Function that is used to stop the generator. Timer 2 is stopped. So the ISR doesn't load the CPU.
+ * @note:       The OC2 Pin stays at the digital level (High or Low) it had when the timer stopped. It's not a PWM anymore.
+ *              So the filtered output doesn't hold the last sample. It drifts to 0 V or Vcc.
+ *
+ * @return      SUCCESS_RETVAL: In case of success, or the generator is already stopped.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: dds_init before.
+ */
+sint32_type dds_stop(void);
+
+#endif  /*__DDS_H__*/
@@ -0,0 +1,451 @@
+/**
+ * @file:           filter.c
+ * @author:         Mina Raouf
+ * @brief:          This file contains the implementation of the fixed point streaming filters used on the ADC samples.
+ * @version:        1.0
+ * @date:           2022-08-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "filter.h"
+#include "errors.h"
+
+#define MAX_Q15_VALUE                   32767
+#define MIN_Q15_VALUE                   (-32768)
+#define MAX_Q31_VALUE                   0x7FFFFFFFL
+#define MIN_Q31_VALUE                   (-MAX_Q31_VALUE - 1)
+
+/**
+ * @brief: Compare and Exchange Element of the sorting networks. After it A holds the minimum and B holds the maximum.
+ */
+#define SORT_PAIR(A, B)                 if((A) > (B))                                   \
+                                        {                                               \
+                                            uint16_type uint16_swap_temp = (A);         \
+                                            (A) = (B);                                  \
+                                            (B) = uint16_swap_temp;                     \
+                                        }
+
+static uint16_type  median_of_3(uint16_type* puint16_window);
+static uint16_type  median_of_5(uint16_type* puint16_window);
+static uint16_type  median_of_7(uint16_type* puint16_window);
+static sint16_type  saturate_to_q15(sint32_type sint32_value);
+static sint32_type  saturating_add_q31(sint32_type sint32_accumulator, sint32_type sint32_value);
+
+/**
+ * @brief:  Sorting network that finds the median of 3 samples using 3 compare and exchange elements.
+ */
+static uint16_type median_of_3(uint16_type* puint16_window)
+{
+    uint16_type p0 = puint16_window[0];
+    uint16_type p1 = puint16_window[1];
+    uint16_type p2 = puint16_window[2];
+
+    SORT_PAIR(p0, p1);
+    SORT_PAIR(p1, p2);
+    SORT_PAIR(p0, p1);
+    return p1;
+}
+
+/**
+ * @brief:  Sorting network that finds the median of 5 samples using 7 compare and exchange elements.
+ */
+static uint16_type median_of_5(uint16_type* puint16_window)
+{
+    uint16_type p0 = puint16_window[0];
+    uint16_type p1 = puint16_window[1];
+    uint16_type p2 = puint16_window[2];
+    uint16_type p3 = puint16_window[3];
+    uint16_type p4 = puint16_window[4];
+
+    SORT_PAIR(p0, p1);
+    SORT_PAIR(p3, p4);
+    SORT_PAIR(p0, p3);
+    SORT_PAIR(p1, p4);
+    SORT_PAIR(p1, p2);
+    SORT_PAIR(p2, p3);
+    SORT_PAIR(p1, p2);
+    return p2;
+}
+
+/**
+ * @brief:  Sorting network that finds the median of 7 samples using 13 compare and exchange elements.
+ */
+static uint16_type median_of_7(uint16_type* puint16_window)
+{
+    uint16_type p0 = puint16_window[0];
+    uint16_type p1 = puint16_window[1];
+    uint16_type p2 = puint16_window[2];
+    uint16_type p3 = puint16_window[3];
+    uint16_type p4 = puint16_window[4];
+    uint16_type p5 = puint16_window[5];
+    uint16_type p6 = puint16_window[6];
+
+    SORT_PAIR(p0, p5);
+    SORT_PAIR(p0, p3);
+    SORT_PAIR(p1, p6);
+    SORT_PAIR(p2, p4);
+    SORT_PAIR(p0, p1);
+    SORT_PAIR(p3, p5);
+    SORT_PAIR(p2, p6);
+    SORT_PAIR(p2, p3);
+    SORT_PAIR(p3, p6);
+    SORT_PAIR(p4, p5);
+    SORT_PAIR(p1, p4);
+    SORT_PAIR(p1, p3);
+    SORT_PAIR(p3, p4);
+    return p3;
+}
+
+/**
+ * @brief:  Function that is used to clamp a value to the signed Q15 range. (-32768 to 32767)
+ */
+static sint16_type saturate_to_q15(sint32_type sint32_value)
+{
+    if(sint32_value > MAX_Q15_VALUE)
+    {
+        sint32_value = MAX_Q15_VALUE;
+    }
+    else if(sint32_value < MIN_Q15_VALUE)
+    {
+        sint32_value = MIN_Q15_VALUE;
+    }
+    return (sint16_type)sint32_value;
+}
+
+/**
+ * @brief:  Function that is used to add a value to the 32 Bits accumulator. The sum is clamped instead of wrapping around on overflow.
+ */
+static sint32_type saturating_add_q31(sint32_type sint32_accumulator, sint32_type sint32_value)
+{
+    if((sint32_value > 0) && (sint32_accumulator > (MAX_Q31_VALUE - sint32_value)))
+    {
+        sint32_accumulator = MAX_Q31_VALUE;
+    }
+    else if((sint32_value < 0) && (sint32_accumulator < (MIN_Q31_VALUE - sint32_value)))
+    {
+        sint32_accumulator = MIN_Q31_VALUE;
+    }
+    else
+    {
+        sint32_accumulator += sint32_value;
+    }
+    return sint32_accumulator;
+}
+
+/**
+ * @brief:      Function that is used to initialize the Exponential Moving Average filter.
+ *
+ * @param[out]  pstr_filter_ema:    Pointer to the filter instance.
+ * @param[in]   uint8_shift:        Smoothing factor as a power of 2 (alpha = 1 / 2^shift). @note: This shall be from 1 to @ref: FILTER_EMA_MAX_SHIFT
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_ema_init(struct_filter_ema_type* pstr_filter_ema, uint8_type uint8_shift)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if((pstr_filter_ema != NULL_PTR) && (uint8_shift > 0) && (uint8_shift <= FILTER_EMA_MAX_SHIFT))
+    {
+        pstr_filter_ema->uint8_shift        = uint8_shift;
+        pstr_filter_ema->uint8_is_primed    = FALSE;
+        pstr_filter_ema->uint32_state       = 0;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Exponential Moving Average filter.
+ * @note:       The first sample after the initialization primes the state to avoid the start-up ramp from 0.
+ *
+ * @param[in]   pstr_filter_ema:    Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_ema_process(struct_filter_ema_type* pstr_filter_ema, uint16_type* puint16_samples, uint16_type uint16_length)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint32_type uint32_state    = 0;
+    uint8_type  uint8_shift     = 0;
+    uint16_type uint16_counter  = 0;
+    if((pstr_filter_ema != NULL_PTR) && (puint16_samples != NULL_PTR) && (uint16_length > 0))
+    {
+        uint8_shift = pstr_filter_ema->uint8_shift;
+        if(pstr_filter_ema->uint8_is_primed == FALSE)
+        {
+            pstr_filter_ema->uint32_state       = ((uint32_type)puint16_samples[0]) << uint8_shift;
+            pstr_filter_ema->uint8_is_primed    = TRUE;
+        }
+
+        /*Keep the state in a local variable through the block. So it's not reloaded from memory on each sample.*/
+        uint32_state = pstr_filter_ema->uint32_state;
+        for(uint16_counter = 0; uint16_counter < uint16_length; uint16_counter++)
+        {
+            /*state = state - state / 2^shift + x. The output is state / 2^shift.*/
+            uint32_state = uint32_state - (uint32_state >> uint8_shift) + puint16_samples[uint16_counter];
+            puint16_samples[uint16_counter] = (uint16_type)(uint32_state >> uint8_shift);
+        }
+        pstr_filter_ema->uint32_state = uint32_state;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to initialize the Box-Car Moving Average filter.
+ *
+ * @param[out]  pstr_filter_boxcar: Pointer to the filter instance.
+ * @param[in]   puint16_history:    Pointer to an array of 2^shift samples owned by the application.
+ * @param[in]   uint8_shift:        The window length as a power of 2. So the division is a shift. @note: This shall be from 1 to @ref: FILTER_BOXCAR_MAX_SHIFT
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_boxcar_init(struct_filter_boxcar_type* pstr_filter_boxcar, uint16_type* puint16_history, uint8_type uint8_shift)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if((pstr_filter_boxcar != NULL_PTR) && (puint16_history != NULL_PTR) && (uint8_shift > 0) && (uint8_shift <= FILTER_BOXCAR_MAX_SHIFT))
+    {
+        pstr_filter_boxcar->puint16_history     = puint16_history;
+        pstr_filter_boxcar->uint8_shift         = uint8_shift;
+        pstr_filter_boxcar->uint8_index         = 0;
+        pstr_filter_boxcar->uint8_is_primed     = FALSE;
+        pstr_filter_boxcar->uint32_running_sum  = 0;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Box-Car Moving Average filter.
+ *              Each sample costs one addition and one subtraction on the running sum regardless of the window length.
+ * @note:       The first sample after the initialization fills the whole history to avoid the start-up ramp from 0.
+ *
+ * @param[in]   pstr_filter_boxcar: Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_boxcar_process(struct_filter_boxcar_type* pstr_filter_boxcar, uint16_type* puint16_samples, uint16_type uint16_length)
+{
+    sint32_type     sint32_retval       = SUCCESS_RETVAL;
+    uint16_type*    puint16_history     = NULL_PTR;
+    uint32_type     uint32_running_sum  = 0;
+    uint8_type      uint8_index         = 0;
+    uint8_type      uint8_mask          = 0;
+    uint8_type      uint8_shift         = 0;
+    uint16_type     uint16_counter      = 0;
+    if((pstr_filter_boxcar != NULL_PTR) && (puint16_samples != NULL_PTR) && (uint16_length > 0))
+    {
+        puint16_history     = pstr_filter_boxcar->puint16_history;
+        uint8_shift         = pstr_filter_boxcar->uint8_shift;
+        uint8_mask          = (uint8_type)((1 << uint8_shift) - 1);
+
+        if(pstr_filter_boxcar->uint8_is_primed == FALSE)
+        {
+            for(uint8_index = 0; uint8_index <= uint8_mask; uint8_index++)
+            {
+                puint16_history[uint8_index] = puint16_samples[0];
+            }
+            pstr_filter_boxcar->uint32_running_sum  = ((uint32_type)puint16_samples[0]) << uint8_shift;
+            pstr_filter_boxcar->uint8_index         = 0;
+            pstr_filter_boxcar->uint8_is_primed     = TRUE;
+        }
+
+        uint32_running_sum  = pstr_filter_boxcar->uint32_running_sum;
+        uint8_index         = pstr_filter_boxcar->uint8_index;
+        for(uint16_counter = 0; uint16_counter < uint16_length; uint16_counter++)
+        {
+            /*Replace the oldest sample in the running sum by the newest one.*/
+            uint32_running_sum          = uint32_running_sum - puint16_history[uint8_index] + puint16_samples[uint16_counter];
+            puint16_history[uint8_index] = puint16_samples[uint16_counter];
+            uint8_index                 = (uint8_index + 1) & uint8_mask;
+            puint16_samples[uint16_counter] = (uint16_type)(uint32_running_sum >> uint8_shift);
+        }
+        pstr_filter_boxcar->uint32_running_sum  = uint32_running_sum;
+        pstr_filter_boxcar->uint8_index         = uint8_index;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to initialize the Median filter.
+ *
+ * @param[out]  pstr_filter_median:         Pointer to the filter instance.
+ * @param[in]   enum_filter_median_window:  The Median Window Length.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_median_init(struct_filter_median_type* pstr_filter_median, enum_filter_median_window_type enum_filter_median_window)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_iterator  = 0;
+    if  (
+            (pstr_filter_median != NULL_PTR) &&
+            (
+                (enum_filter_median_window == FILTER_MEDIAN_WINDOW_3) ||
+                (enum_filter_median_window == FILTER_MEDIAN_WINDOW_5) ||
+                (enum_filter_median_window == FILTER_MEDIAN_WINDOW_7)
+            )
+        )
+    {
+        for(uint8_iterator = 0; uint8_iterator < FILTER_MEDIAN_MAX_WINDOW; uint8_iterator++)
+        {
+            pstr_filter_median->arr_uint16_window[uint8_iterator] = 0;
+        }
+        pstr_filter_median->enum_filter_median_window   = enum_filter_median_window;
+        pstr_filter_median->uint8_index                 = 0;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Median filter.
+ *
+ * @param[in]   pstr_filter_median: Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_median_process(struct_filter_median_type* pstr_filter_median, uint16_type* puint16_samples, uint16_type uint16_length)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint16_type uint16_counter  = 0;
+    if((pstr_filter_median != NULL_PTR) && (puint16_samples != NULL_PTR) && (uint16_length > 0))
+    {
+        for(uint16_counter = 0; uint16_counter < uint16_length; uint16_counter++)
+        {
+            /*The window order doesn't matter for the median. So the oldest sample is simply overwritten.*/
+            pstr_filter_median->arr_uint16_window[pstr_filter_median->uint8_index] = puint16_samples[uint16_counter];
+            pstr_filter_median->uint8_index++;
+            if(pstr_filter_median->uint8_index == (uint8_type)(pstr_filter_median->enum_filter_median_window))
+            {
+                pstr_filter_median->uint8_index = 0;
+            }
+
+            switch(pstr_filter_median->enum_filter_median_window)
+            {
+                case FILTER_MEDIAN_WINDOW_3:
+                {
+                    puint16_samples[uint16_counter] = median_of_3(pstr_filter_median->arr_uint16_window);
+                    break;
+                }
+                case FILTER_MEDIAN_WINDOW_5:
+                {
+                    puint16_samples[uint16_counter] = median_of_5(pstr_filter_median->arr_uint16_window);
+                    break;
+                }
+                case FILTER_MEDIAN_WINDOW_7:
+                {
+                    puint16_samples[uint16_counter] = median_of_7(pstr_filter_median->arr_uint16_window);
+                    break;
+                }
+                default:
+                {
+                    sint32_retval = ERROR_INVALID_ARGUMENTS;
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to initialize the Biquad filter and clear its history.
+ *
+ * @param[out]  pstr_filter_biquad: Pointer to the filter instance. The coefficients and the post shift shall be filled by the application before calling this function.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_biquad_q15_init(struct_filter_biquad_q15_type* pstr_filter_biquad)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if((pstr_filter_biquad != NULL_PTR) && (pstr_filter_biquad->uint8_post_shift < FILTER_BIQUAD_Q15_FRACTION_BITS))
+    {
+        pstr_filter_biquad->sint16_x1 = 0;
+        pstr_filter_biquad->sint16_x2 = 0;
+        pstr_filter_biquad->sint16_y1 = 0;
+        pstr_filter_biquad->sint16_y2 = 0;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Biquad filter.
+ *
+ * @param[in]   pstr_filter_biquad: Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. (Signed Q15 as two's complement) The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_biquad_q15_process(struct_filter_biquad_q15_type* pstr_filter_biquad, uint16_type* puint16_samples, uint16_type uint16_length)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    sint32_type sint32_accumulator  = 0;
+    sint16_type sint16_x0           = 0;
+    sint16_type sint16_y0           = 0;
+    uint8_type  uint8_output_shift  = 0;
+    uint16_type uint16_counter      = 0;
+    if((pstr_filter_biquad != NULL_PTR) && (puint16_samples != NULL_PTR) && (uint16_length > 0))
+    {
+        uint8_output_shift = FILTER_BIQUAD_Q15_FRACTION_BITS - pstr_filter_biquad->uint8_post_shift;
+        for(uint16_counter = 0; uint16_counter < uint16_length; uint16_counter++)
+        {
+            sint16_x0 = (sint16_type)puint16_samples[uint16_counter];
+
+            /*16 x 16 Bits products accumulated in 32 Bits. Then rounded back to the samples scale.
+              Each product fits in 31 Bits but five of them don't. So the sum is saturated and an overflow clips the output instead of flipping its sign.*/
+            sint32_accumulator  = ((sint32_type)pstr_filter_biquad->sint16_b0 * sint16_x0);
+            sint32_accumulator  = saturating_add_q31(sint32_accumulator, ((sint32_type)pstr_filter_biquad->sint16_b1 * pstr_filter_biquad->sint16_x1));
+            sint32_accumulator  = saturating_add_q31(sint32_accumulator, ((sint32_type)pstr_filter_biquad->sint16_b2 * pstr_filter_biquad->sint16_x2));
+            sint32_accumulator  = saturating_add_q31(sint32_accumulator, -((sint32_type)pstr_filter_biquad->sint16_a1 * pstr_filter_biquad->sint16_y1));
+            sint32_accumulator  = saturating_add_q31(sint32_accumulator, -((sint32_type)pstr_filter_biquad->sint16_a2 * pstr_filter_biquad->sint16_y2));
+            sint32_accumulator  = saturating_add_q31(sint32_accumulator, ((sint32_type)1 << (uint8_output_shift - 1)));
+
+            sint16_y0 = saturate_to_q15(sint32_accumulator >> uint8_output_shift);
+
+            pstr_filter_biquad->sint16_x2 = pstr_filter_biquad->sint16_x1;
+            pstr_filter_biquad->sint16_x1 = sint16_x0;
+            pstr_filter_biquad->sint16_y2 = pstr_filter_biquad->sint16_y1;
+            pstr_filter_biquad->sint16_y1 = sint16_y0;
+
+            puint16_samples[uint16_counter] = (uint16_type)sint16_y0;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file:           filter.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration and the needed types for the fixed point streaming filters used on the ADC samples.
+ * @note:           All the filters use integer arithmetic only. No fint32_type / fint64_type is used as the AVR has no FPU.
+ *                  Each process function operates in place on a block of samples.
+ */
+
+#ifndef __FILTER_H__
+#define __FILTER_H__
+
+#include "types.h"
+
+#define FILTER_EMA_MAX_SHIFT                15
+#define FILTER_BOXCAR_MAX_SHIFT             7
+#define FILTER_MEDIAN_MAX_WINDOW            7
+#define FILTER_BIQUAD_Q15_FRACTION_BITS     15
+
+/**
+ * @enum:   enum_filter_median_window_type
+ * @brief:  Enumeration of the Supported Median Windows. Each window has its own optimal sorting network.
+ */
+typedef enum
+{
+    FILTER_MEDIAN_WINDOW_3  = 3,
+    FILTER_MEDIAN_WINDOW_5  = 5,
+    FILTER_MEDIAN_WINDOW_7  = 7,
+    FILTER_MEDIAN_WINDOW_INVALID
+}enum_filter_median_window_type;
+
+/**
+ * @struct: struct_filter_ema_type
+ * @brief:  Exponential Moving Average. y += (x - y) / 2^shift. The state keeps the shift fraction bits to avoid the truncation bias.
+ */
+typedef struct
+{
+    uint8_type      uint8_shift;
+    uint8_type      uint8_is_primed;
+    uint32_type     uint32_state;
+}struct_filter_ema_type;
+
+/**
+ * @struct: struct_filter_boxcar_type
+ * @brief:  Box-Car Moving Average over 2^shift samples using a running sum. The history buffer is provided by the application.
+ */
+typedef struct
+{
+    uint16_type*    puint16_history;
+    uint8_type      uint8_shift;
+    uint8_type      uint8_index;
+    uint8_type      uint8_is_primed;
+    uint32_type     uint32_running_sum;
+}struct_filter_boxcar_type;
+
+/**
+ * @struct: struct_filter_median_type
+ * @brief:  Median of the last N samples using a sorting network.
+ */
+typedef struct
+{
+    uint16_type                     arr_uint16_window[FILTER_MEDIAN_MAX_WINDOW];
+    enum_filter_median_window_type  enum_filter_median_window;
+    uint8_type                      uint8_index;
+}struct_filter_median_type;
+
+/**
+ * @struct: struct_filter_biquad_q15_type
+ * @brief:  Biquad IIR (Direct Form I). y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+ *          The coefficients are in Q15 scaled down by 2^post_shift. Ex: with uint8_post_shift = 1, a1 = -1.8 is stored as -1.8 * 2^14.
+ *          So each coefficient shall satisfy |c| < 2^post_shift. (|c| < 2 covers any stable a1 with post_shift = 1)
+ * @note:   The samples are signed Q15 (-32768 to 32767) stored in the uint16_type blocks as two's complement. The ADC codes (0 to 1023, or up to 8191 with the oversampling) are positive samples.
+ *          The outputs are saturated to -32768 to 32767. So a high pass or a band pass filter keeps the negative half of the signal. Read the outputs as sint16_type.
+ *          The 32 Bits accumulator is saturated. The response is linear while the peak gain of the filter times the input amplitude stays below 32768.
+ *          Above that the output clips at the Q15 limits instead of wrapping around.
+ */
+typedef struct
+{
+    sint16_type     sint16_b0;
+    sint16_type     sint16_b1;
+    sint16_type     sint16_b2;
+    sint16_type     sint16_a1;
+    sint16_type     sint16_a2;
+    uint8_type      uint8_post_shift;
+    sint16_type     sint16_x1;
+    sint16_type     sint16_x2;
+    sint16_type     sint16_y1;
+    sint16_type     sint16_y2;
+}struct_filter_biquad_q15_type;
+
+/**
+ * @brief:      Function that is used to initialize the Exponential Moving Average filter.
+ *
+ * @param[out]  pstr_filter_ema:    Pointer to the filter instance.
+ * @param[in]   uint8_shift:        Smoothing factor as a power of 2 (alpha = 1 / 2^shift). @note: This shall be from 1 to @ref: FILTER_EMA_MAX_SHIFT
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_ema_init(struct_filter_ema_type* pstr_filter_ema, uint8_type uint8_shift);
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Exponential Moving Average filter.
+ * @note:       The first sample after the initialization primes the state to avoid the start-up ramp from 0.
+ *
+ * @param[in]   pstr_filter_ema:    Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_ema_process(struct_filter_ema_type* pstr_filter_ema, uint16_type* puint16_samples, uint16_type uint16_length);
+
+/**
+ * @brief:      Function that is used to initialize the Box-Car Moving Average filter.
+ *
+ * @param[out]  pstr_filter_boxcar: Pointer to the filter instance.
+ * @param[in]   puint16_history:    Pointer to an array of 2^shift samples owned by the application.
+ * @param[in]   uint8_shift:        The window length as a power of 2. So the division is a shift. @note: This shall be from 1 to @ref: FILTER_BOXCAR_MAX_SHIFT
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_boxcar_init(struct_filter_boxcar_type* pstr_filter_boxcar, uint16_type* puint16_history, uint8_type uint8_shift);
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Box-Car Moving Average filter.
+ *              Each sample costs one addition and one subtraction on the running sum regardless of the window length.
+ * @note:       The first sample after the initialization fills the whole history to avoid the start-up ramp from 0.
+ *
+ * @param[in]   pstr_filter_boxcar: Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_boxcar_process(struct_filter_boxcar_type* pstr_filter_boxcar, uint16_type* puint16_samples, uint16_type uint16_length);
+
+/**
+ * @brief:      Function that is used to initialize the Median filter.
+ *
+ * @param[out]  pstr_filter_median:         Pointer to the filter instance.
+ * @param[in]   enum_filter_median_window:  The Median Window Length.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_median_init(struct_filter_median_type* pstr_filter_median, enum_filter_median_window_type enum_filter_median_window);
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Median filter.
+ *
+ * @param[in]   pstr_filter_median: Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_median_process(struct_filter_median_type* pstr_filter_median, uint16_type* puint16_samples, uint16_type uint16_length);
+
+/**
+ * @brief:      Function that is used to initialize the Biquad filter and clear its history.
+ *
+ * @param[out]  pstr_filter_biquad: Pointer to the filter instance. The coefficients and the post shift shall be filled by the application before calling this function.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_biquad_q15_init(struct_filter_biquad_q15_type* pstr_filter_biquad);
+
+/**
+ * @brief:      Function that is used to filter a block of samples in place using the Biquad filter.
+ *
+ * @param[in]   pstr_filter_biquad: Pointer to the filter instance.
+ * @param[in]   puint16_samples:    Pointer to the block of samples. (Signed Q15 as two's complement) The outputs overwrite the inputs.
+ * @param[in]   uint16_length:      Number of samples in the block.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type filter_biquad_q15_process(struct_filter_biquad_q15_type* pstr_filter_biquad, uint16_type* puint16_samples, uint16_type uint16_length);
+
+#endif  /*__FILTER_H__*/
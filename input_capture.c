@@ -0,0 +1,276 @@
+/**
+ * @file:       input_capture.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Input Capture Measurement on the ICP1 Pin.
+ * @version:    1.0
+ * @date:       2022-08-29
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "input_capture.h"
+#include "timestamp.h"
+#include "timer.h"
+#include "errors.h"
+#include "gpio.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+
+#define INPUT_CAPTURE_FALSE             0
+#define INPUT_CAPTURE_TRUE              1
+
+#define ICES1_BIT                       6   /*Bit Index inside the REG_TCCR1B*/
+#define ICNC1_BIT                       7   /*Bit Index inside the REG_TCCR1B*/
+#define ICF1_BIT                        5   /*Bit Index inside the REG_TIFR*/
+#define I_BIT                           7   /*Bit Index inside the REG_SREG*/
+
+#define ICP1_PORT                       ENU_PORT_D
+#define ICP1_PIN                        6
+
+#define INPUT_CAPTURE_TICKS_PER_SECOND  (1000000UL << TIMESTAMP_TICKS_PER_US_SHIFT)
+#define INPUT_CAPTURE_MAX_TIMEOUT_IN_US (0x7FFFFFFFUL >> TIMESTAMP_TICKS_PER_US_SHIFT)
+#define INPUT_CAPTURE_SCALE             1000UL
+
+static uint8_type               guint8_is_module_initialized        = INPUT_CAPTURE_FALSE;
+static uint8_type               guint8_window_in_periods            = 0;
+static uint8_type               guint8_is_duty_cycle_enabled        = INPUT_CAPTURE_FALSE;
+static uint8_type               guint8_reference_edge_ices1         = 0;
+static uint32_type              guint32_timeout_in_ticks            = 0;
+
+/*The State of the current window. It's owned by the ISR.*/
+static volatile uint8_type      guint8_is_waiting_reference_edge    = INPUT_CAPTURE_TRUE;
+static volatile uint8_type      guint8_is_window_started            = INPUT_CAPTURE_FALSE;
+static volatile uint8_type      guint8_number_of_periods            = 0;
+static volatile uint32_type     guint32_window_start_in_ticks       = 0;
+static volatile uint32_type     guint32_last_reference_in_ticks     = 0;
+static volatile uint32_type     guint32_active_sum_in_ticks         = 0;
+
+/*The result of the last complete window.*/
+static volatile uint8_type      guint8_is_measurement_valid         = INPUT_CAPTURE_FALSE;
+static volatile uint32_type     guint32_window_in_ticks             = 0;
+static volatile uint32_type     guint32_window_active_in_ticks      = 0;
+
+static void         input_capture_callback(enum_timer_index_type enum_timer_index);
+static void         select_capture_edge(uint8_type uint8_ices1_value);
+static uint32_type  scale_and_divide(uint32_type uint32_numerator, uint32_type uint32_denominator);
+
+/**
+ * @brief:  Function that is used to select the next captured edge. The Input Capture Flag may be raised by the change. So it's cleared.
+ * @return  None
+ */
+static void select_capture_edge(uint8_type uint8_ices1_value)
+{
+    if(uint8_ices1_value != 0)
+    {
+        SET_BIT(REG_TCCR1B, ICES1_BIT);
+    }
+    else
+    {
+        CLEAR_BIT(REG_TCCR1B, ICES1_BIT);
+    }
+    REG_TIFR = (1<<ICF1_BIT);
+}
+
+/**
+ * @brief:  Function that is used to compute (numerator * 1000 / denominator) without a 64 Bits product.
+ *          The remainder is scaled alone. If it can't be multiplied by 1000, the denominator is divided instead. (The error is less than 0.1 %)
+ * @return  The scaled quotient.
+ */
+static uint32_type scale_and_divide(uint32_type uint32_numerator, uint32_type uint32_denominator)
+{
+    uint32_type uint32_quotient     = uint32_numerator / uint32_denominator;
+    uint32_type uint32_remainder    = uint32_numerator % uint32_denominator;
+    uint32_type uint32_fraction     = 0;
+    if(uint32_remainder <= (0xFFFFFFFFUL / INPUT_CAPTURE_SCALE))
+    {
+        uint32_fraction = (uint32_remainder * INPUT_CAPTURE_SCALE) / uint32_denominator;
+    }
+    else
+    {
+        uint32_fraction = uint32_remainder / (uint32_denominator / INPUT_CAPTURE_SCALE);
+    }
+    return (uint32_quotient * INPUT_CAPTURE_SCALE) + uint32_fraction;
+}
+
+/**
+ * @brief:  The Input Capture callback. It's called from the TIMER1_CAPT ISR.
+ *          The Reference Edges close the periods of the window. The other edges close the Active Times.
+ * @note:   The pulses shall be longer than the ISR latency when the Duty Cycle is enabled. Otherwise the other edge is lost.
+ * @return  None
+ */
+static void input_capture_callback(enum_timer_index_type enum_timer_index)
+{
+    uint32_type uint32_edge_in_ticks = time_extend_ticks(REG_ICR1);
+    (void)enum_timer_index;
+
+    if(guint8_is_waiting_reference_edge == INPUT_CAPTURE_TRUE)
+    {
+        if(guint8_is_window_started == INPUT_CAPTURE_FALSE)
+        {
+            guint8_is_window_started        = INPUT_CAPTURE_TRUE;
+            guint8_number_of_periods        = 0;
+            guint32_active_sum_in_ticks     = 0;
+            guint32_window_start_in_ticks   = uint32_edge_in_ticks;
+        }
+        else
+        {
+            guint8_number_of_periods++;
+            if(guint8_number_of_periods == guint8_window_in_periods)
+            {
+                guint32_window_in_ticks         = uint32_edge_in_ticks - guint32_window_start_in_ticks;
+                guint32_window_active_in_ticks  = guint32_active_sum_in_ticks;
+                guint8_is_measurement_valid     = INPUT_CAPTURE_TRUE;
+                guint8_number_of_periods        = 0;
+                guint32_active_sum_in_ticks     = 0;
+                guint32_window_start_in_ticks   = uint32_edge_in_ticks;
+            }
+        }
+        guint32_last_reference_in_ticks = uint32_edge_in_ticks;
+
+        if(guint8_is_duty_cycle_enabled == INPUT_CAPTURE_TRUE)
+        {
+            guint8_is_waiting_reference_edge = INPUT_CAPTURE_FALSE;
+            select_capture_edge(guint8_reference_edge_ices1 ^ 1);
+        }
+    }
+    else
+    {
+        guint32_active_sum_in_ticks     += uint32_edge_in_ticks - guint32_last_reference_in_ticks;
+        guint8_is_waiting_reference_edge = INPUT_CAPTURE_TRUE;
+        select_capture_edge(guint8_reference_edge_ices1);
+    }
+}
+
+/**
+ * @brief:      Function that is used to initialize the Input Capture Measurement and enable the Input Capture Interrupt.
+ *
+ * @param[in]   pstr_input_capture_config:  Address of the Input Capture Configurations.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              Or any error returned by @fn: timer_set_input_capture_callback. (Ex: ERROR_MODULE_NOT_INITAILIZED in case that the Time Base is not initialized)
+ */
+sint32_type input_capture_init(const struct_input_capture_config_type* pstr_input_capture_config)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if  (
+            (pstr_input_capture_config != NULL_PTR) &&
+            (pstr_input_capture_config->enum_input_capture_edge < INPUT_CAPTURE_EDGE_INVALID) &&
+            (pstr_input_capture_config->uint8_window_in_periods != 0) &&
+            (pstr_input_capture_config->uint32_timeout_in_us != 0) &&
+            (pstr_input_capture_config->uint32_timeout_in_us <= INPUT_CAPTURE_MAX_TIMEOUT_IN_US)
+        )
+    {
+        /*Disable the Interrupt while the edge and the state are changed.*/
+        timer_set_input_capture_callback(TIMER_INDEX_1, NULL_PTR);
+
+        gpio_set_pin_direction(ICP1_PORT, ICP1_PIN, ENU_DIRECTION_INPUT);
+        if(pstr_input_capture_config->uint8_is_noise_canceler_enabled == TRUE)
+        {
+            SET_BIT(REG_TCCR1B, ICNC1_BIT);
+        }
+        else
+        {
+            CLEAR_BIT(REG_TCCR1B, ICNC1_BIT);
+        }
+
+        guint8_window_in_periods            = pstr_input_capture_config->uint8_window_in_periods;
+        guint8_is_duty_cycle_enabled        = pstr_input_capture_config->uint8_is_duty_cycle_enabled;
+        guint8_reference_edge_ices1         = (pstr_input_capture_config->enum_input_capture_edge == INPUT_CAPTURE_EDGE_RISING) ? 1 : 0;
+        guint32_timeout_in_ticks            = pstr_input_capture_config->uint32_timeout_in_us << TIMESTAMP_TICKS_PER_US_SHIFT;
+        guint8_is_waiting_reference_edge    = INPUT_CAPTURE_TRUE;
+        guint8_is_window_started            = INPUT_CAPTURE_FALSE;
+        guint8_is_measurement_valid         = INPUT_CAPTURE_FALSE;
+        select_capture_edge(guint8_reference_edge_ices1);
+
+        sint32_retval = timer_set_input_capture_callback(TIMER_INDEX_1, input_capture_callback);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            guint8_is_module_initialized = INPUT_CAPTURE_TRUE;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to disable the Input Capture Interrupt.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: input_capture_init before.
+ */
+sint32_type input_capture_deinit(void)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == INPUT_CAPTURE_TRUE)
+    {
+        sint32_retval = timer_set_input_capture_callback(TIMER_INDEX_1, NULL_PTR);
+        guint8_is_module_initialized = INPUT_CAPTURE_FALSE;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to get the result of the last complete window.
+ *
+ * @param[out]  pstr_input_capture_measurement: Address of a structure in which the result will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: input_capture_init before.
+ *              ERROR_MODULE_BUSY: In case that no window is completed yet or the signal has stopped for more than the timeout.
+ */
+sint32_type input_capture_get_measurement(struct_input_capture_measurement_type* pstr_input_capture_measurement)
+{
+    sint32_type sint32_retval                   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg                      = 0;
+    uint8_type  uint8_is_measurement_valid      = INPUT_CAPTURE_FALSE;
+    uint32_type uint32_window_in_ticks          = 0;
+    uint32_type uint32_window_active_in_ticks   = 0;
+    if(guint8_is_module_initialized == INPUT_CAPTURE_TRUE)
+    {
+        if(pstr_input_capture_measurement != NULL_PTR)
+        {
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            if((time_now_ticks() - guint32_last_reference_in_ticks) > guint32_timeout_in_ticks)
+            {
+                /*The signal has stopped. The next edge starts a new window.*/
+                guint8_is_measurement_valid         = INPUT_CAPTURE_FALSE;
+                guint8_is_window_started            = INPUT_CAPTURE_FALSE;
+                guint8_is_waiting_reference_edge    = INPUT_CAPTURE_TRUE;
+                select_capture_edge(guint8_reference_edge_ices1);
+            }
+            uint8_is_measurement_valid      = guint8_is_measurement_valid;
+            uint32_window_in_ticks          = guint32_window_in_ticks;
+            uint32_window_active_in_ticks   = guint32_window_active_in_ticks;
+            REG_SREG = uint8_sreg;
+
+            if((uint8_is_measurement_valid == INPUT_CAPTURE_TRUE) && (uint32_window_in_ticks != 0))
+            {
+                pstr_input_capture_measurement->uint32_period_in_us             = TIMESTAMP_TICKS_TO_US(uint32_window_in_ticks / guint8_window_in_periods);
+                pstr_input_capture_measurement->uint32_frequency_in_millihertz  = scale_and_divide(INPUT_CAPTURE_TICKS_PER_SECOND * guint8_window_in_periods, uint32_window_in_ticks);
+                pstr_input_capture_measurement->uint16_duty_cycle_in_permille   = (uint16_type)scale_and_divide(uint32_window_active_in_ticks, uint32_window_in_ticks);
+            }
+            else
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
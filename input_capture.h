@@ -0,0 +1,80 @@
+/**
+ * @file:           input_capture.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration and the needed types of the Input Capture Measurement.
+ *                  The edges on the ICP1 Pin (PD6) are timestamped by the hardware in ICR1 and extended to 32 Bits by the Time Base.
+ *                  So the Period, the Frequency and the Duty Cycle don't depend on the main loop latency.
+ * @note:           @ref: timestamp_init shall be called before @ref: input_capture_init as Timer 1 shall be free running.
+ */
+
+#ifndef __INPUT_CAPTURE_H__
+#define __INPUT_CAPTURE_H__
+
+#include "types.h"
+
+/**
+ * @enum:   enum_input_capture_edge_type
+ * @brief:  Enumeration of the Reference Edge. The Period is measured between two Reference Edges.
+ *          The Active Time used by the Duty Cycle starts on the Reference Edge. (Ex: The High Time for the Rising Edge)
+ */
+typedef enum
+{
+    INPUT_CAPTURE_EDGE_FALLING = 0,
+    INPUT_CAPTURE_EDGE_RISING,
+    INPUT_CAPTURE_EDGE_INVALID
+}enum_input_capture_edge_type;
+
+/**
+ * @struct: struct_input_capture_config_type
+ * @brief:  Configurations of the Input Capture Measurement.
+ */
+typedef struct
+{
+    enum_input_capture_edge_type    enum_input_capture_edge;
+    uint8_type                      uint8_is_noise_canceler_enabled;    /*TRUE: The edge shall be stable for 4 CPU Cycles. It adds 4 Cycles of delay to each edge.*/
+    uint8_type                      uint8_is_duty_cycle_enabled;        /*TRUE: Both edges are captured. This doubles the interrupts.*/
+    uint8_type                      uint8_window_in_periods;            /*The measurement is averaged over this number of periods. @note: This shall not be 0.*/
+    uint32_type                     uint32_timeout_in_us;               /*The measurement is invalid if no Reference Edge is captured within this time. @note: This shall not be 0.*/
+}struct_input_capture_config_type;
+
+/**
+ * @struct: struct_input_capture_measurement_type
+ * @brief:  The result of the last complete window.
+ */
+typedef struct
+{
+    uint32_type     uint32_period_in_us;
+    uint32_type     uint32_frequency_in_millihertz;
+    uint16_type     uint16_duty_cycle_in_permille;      /*0 in case that the duty cycle measurement is disabled.*/
+}struct_input_capture_measurement_type;
+
+/**
+ * @brief:      Function that is used to initialize the Input Capture Measurement and enable the Input Capture Interrupt.
+ *
+ * @param[in]   pstr_input_capture_config:  Address of the Input Capture Configurations.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              Or any error returned by @fn: timer_set_input_capture_callback. (Ex: ERROR_MODULE_NOT_INITAILIZED in case that the Time Base is not initialized)
+ */
+sint32_type input_capture_init(const struct_input_capture_config_type* pstr_input_capture_config);
+
+/**
+ * @brief:      Function that is used to disable the Input Capture Interrupt.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: input_capture_init before.
+ */
+sint32_type input_capture_deinit(void);
+
+/**
+ * @brief:      Function that is used to get the result of the last complete window.
+ *
+ * @param[out]  pstr_input_capture_measurement: Address of a structure in which the result will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: input_capture_init before.
+ *              ERROR_MODULE_BUSY: In case that no window is completed yet or the signal has stopped for more than the timeout.
+ */
+sint32_type input_capture_get_measurement(struct_input_capture_measurement_type* pstr_input_capture_measurement);
+
+#endif  /*__INPUT_CAPTURE_H__*/
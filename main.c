@@ -7,6 +7,8 @@
 #include "lcd.h"
 #include "gpio.h"
 #include "timer.h"
+#include "timestamp.h"
+#include "scheduler.h"
 #include "bit_manipulation.h"
 #include "errors.h"
 #include "common.h"
@@ -19,6 +21,7 @@
 #define STRING		"Hello Mina Raouf"
 
 void generic_timer_callback(enum_timer_index_type enum_timer_index);
+static void button_task(void);
 
 static const tstr_timer_config gstr_timer_0_config =	{
 															.enum_timer_index				= TIMER_INDEX_0,
@@ -44,6 +47,15 @@ static const tstr_timer_config gstr_timer_0_pwm_config =	{
 																.pointer_func_timer_callback	= generic_timer_callback,
 															};
 
+static const struct_scheduler_task_config_type garr_str_scheduler_tasks[] =	{
+																				{
+																					.pointer_func_scheduler_task	= button_task,
+																					.uint32_period_in_us			= 10000,
+																					.uint32_offset_in_us			= 0,
+																					.uint8_priority					= 1,
+																				},
+																			};
+
 void generic_timer_callback(enum_timer_index_type enum_timer_index)
 {
 	switch(enum_timer_index)
@@ -72,6 +84,19 @@ void generic_timer_callback(enum_timer_index_type enum_timer_index)
 	}	
 }
 
+/*Mirror the PB0 Button on PA3 every 10 ms.*/
+static void button_task(void)
+{
+	if(GET_BIT(REG_PINB, 0) == 1)
+	{
+		gpio_mainpulate_pin(ENU_OPERATION_SET, ENU_PORT_A, 3);
+	}
+	else
+	{
+		gpio_mainpulate_pin(ENU_OPERATION_CLEAR, ENU_PORT_A, 3);
+	}
+}
+
 int main(void)
 {
 	sint32_type sint32_retval = SUCCESS_RETVAL;
@@ -97,24 +122,25 @@ int main(void)
 	
 	sint32_retval = timer_generate_pwm(TIMER_INDEX_0, 5);
 
-	//sint32_retval = timer_delay(TIMER_INDEX_0, 5000);
-	//sint32_retval = timer_delay(TIMER_INDEX_2, 2000);
+	//sint32_retval = timer_delay(TIMER_INDEX_0, 5000, TIMER_DELAY_ONE_SHOT);
+	//sint32_retval = timer_delay(TIMER_INDEX_2, 2000, TIMER_DELAY_PERIODIC);
 
 
 	//lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, F_CPU);
 	
 	
+	sint32_retval = timestamp_init();
+	if(sint32_retval == SUCCESS_RETVAL)
+	{
+		sint32_retval = scheduler_init(garr_str_scheduler_tasks, (sizeof(garr_str_scheduler_tasks) / sizeof(garr_str_scheduler_tasks[0])), NULL_PTR);
+	}
+
+	/*The Scheduler sleeps the CPU between the task releases. It never returns.*/
+	scheduler_run();
+
     /* Replace with your application code */
     while (1) 
     {
-		if(GET_BIT(REG_PINB, 0) == 1)
-		{
-			gpio_mainpulate_pin(ENU_OPERATION_SET, ENU_PORT_A, 3);
-		}
-		else
-		{
-			gpio_mainpulate_pin(ENU_OPERATION_CLEAR, ENU_PORT_A, 3);
-		}
     }
 }
 
@@ -0,0 +1,305 @@
+/**
+ * @file:       rtc.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Real Time Clock on the asynchronous Timer 2.
+ * @version:    1.0
+ * @date:       2022-08-30
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "rtc.h"
+#include "timer.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#define RTC_FALSE                       0
+#define RTC_TRUE                        1
+
+#define TCR2UB_BIT                      0   /*Bit Index inside the REG_ASSR*/
+#define TCN2UB_BIT                      2   /*Bit Index inside the REG_ASSR*/
+#define PSR2_BIT                        1   /*Bit Index inside the REG_SFIOR*/
+#define TOV2_BIT                        6   /*Bit Index inside the REG_TIFR*/
+#define SM0_BIT                         4   /*Bit Index inside the REG_MCUCR*/
+#define SM1_BIT                         5   /*Bit Index inside the REG_MCUCR*/
+#define SE_BIT                          7   /*Bit Index inside the REG_MCUCR*/
+#define I_BIT                           7   /*Bit Index inside the REG_SREG*/
+
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_MCUCR_SLEEP_BITS_MASK (SE and SM2:0 Bits. SM2:0 = 011 for the Power Save Sleep)
+ *
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| 1     | 1     | 1     | 1     | 0     | 0     |  0    | 0     |
+|---------------------------------------------------------------|
+*/
+#define REG_MCUCR_SLEEP_BITS_MASK       0xF0
+
+/*32768 Hz / 128 = 256 Ticks per second. So Timer 2 overflows exactly once per second.*/
+#define RTC_TIMER_PRESCALAR             TIMER_128_PRESCALAR
+
+#define RTC_SECONDS_PER_MINUTE          60
+#define RTC_MINUTES_PER_HOUR            60
+#define RTC_HOURS_PER_DAY               24
+#define RTC_MONTHS_PER_YEAR             12
+#define RTC_FEBRUARY                    2
+
+static const uint8_type garr_uint8_days_per_month[RTC_MONTHS_PER_YEAR] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+static volatile struct_rtc_date_time_type   gstr_rtc_date_time;
+static pointer_func_rtc_callback_type       gpointer_func_rtc_callback      = NULL_PTR;
+static uint8_type                           guint8_is_module_initialized    = RTC_FALSE;
+
+static void         rtc_second_callback(enum_timer_index_type enum_timer_index);
+static uint8_type   get_days_of_month(uint16_type uint16_year, uint8_type uint8_month);
+static uint8_type   is_valid_date_time(const struct_rtc_date_time_type* pstr_rtc_date_time);
+
+/**
+ * @brief:  Function that is used to get the number of days of a month. February has 29 days in the Leap Years.
+ * @return  The number of days.
+ */
+static uint8_type get_days_of_month(uint16_type uint16_year, uint8_type uint8_month)
+{
+    uint8_type uint8_days = garr_uint8_days_per_month[uint8_month - 1];
+    if  (
+            (uint8_month == RTC_FEBRUARY) &&
+            ((((uint16_year % 4) == 0) && ((uint16_year % 100) != 0)) || ((uint16_year % 400) == 0))
+        )
+    {
+        uint8_days++;
+    }
+    return uint8_days;
+}
+
+/**
+ * @brief:  Function that is used to check the ranges of the Date and Time.
+ * @return  RTC_TRUE: In case of a valid Date and Time. Otherwise RTC_FALSE.
+ */
+static uint8_type is_valid_date_time(const struct_rtc_date_time_type* pstr_rtc_date_time)
+{
+    uint8_type uint8_is_valid = RTC_FALSE;
+    if  (
+            (pstr_rtc_date_time->uint8_month >= 1) &&
+            (pstr_rtc_date_time->uint8_month <= RTC_MONTHS_PER_YEAR) &&
+            (pstr_rtc_date_time->uint8_hour < RTC_HOURS_PER_DAY) &&
+            (pstr_rtc_date_time->uint8_minute < RTC_MINUTES_PER_HOUR) &&
+            (pstr_rtc_date_time->uint8_second < RTC_SECONDS_PER_MINUTE)
+        )
+    {
+        if  (
+                (pstr_rtc_date_time->uint8_day >= 1) &&
+                (pstr_rtc_date_time->uint8_day <= get_days_of_month(pstr_rtc_date_time->uint16_year, pstr_rtc_date_time->uint8_month))
+            )
+        {
+            uint8_is_valid = RTC_TRUE;
+        }
+    }
+    return uint8_is_valid;
+}
+
+/**
+ * @brief:  Timer 2 Overflow callback. It's called once per second from the ISR. The carry is moved up to the year.
+ * @return  None
+ */
+static void rtc_second_callback(enum_timer_index_type enum_timer_index)
+{
+    (void)enum_timer_index;
+    gstr_rtc_date_time.uint8_second++;
+    if(gstr_rtc_date_time.uint8_second >= RTC_SECONDS_PER_MINUTE)
+    {
+        gstr_rtc_date_time.uint8_second = 0;
+        gstr_rtc_date_time.uint8_minute++;
+        if(gstr_rtc_date_time.uint8_minute >= RTC_MINUTES_PER_HOUR)
+        {
+            gstr_rtc_date_time.uint8_minute = 0;
+            gstr_rtc_date_time.uint8_hour++;
+            if(gstr_rtc_date_time.uint8_hour >= RTC_HOURS_PER_DAY)
+            {
+                gstr_rtc_date_time.uint8_hour = 0;
+                gstr_rtc_date_time.uint8_day++;
+                if(gstr_rtc_date_time.uint8_day > get_days_of_month(gstr_rtc_date_time.uint16_year, gstr_rtc_date_time.uint8_month))
+                {
+                    gstr_rtc_date_time.uint8_day = 1;
+                    gstr_rtc_date_time.uint8_month++;
+                    if(gstr_rtc_date_time.uint8_month > RTC_MONTHS_PER_YEAR)
+                    {
+                        gstr_rtc_date_time.uint8_month = 1;
+                        gstr_rtc_date_time.uint16_year++;
+                    }
+                }
+            }
+        }
+    }
+
+    if(gpointer_func_rtc_callback != NULL_PTR)
+    {
+        gpointer_func_rtc_callback();
+    }
+}
+
+/**
+ * @brief:      Function that is used to switch Timer 2 to the Watch Crystal and start the Real Time Clock.
+ * @note:       The crystal takes up to one second to be stable after the power up. So the first second may be longer.
+ *
+ * @param[in]   pstr_rtc_date_time:             Address of the initial Date and Time.
+ * @param[in]   pointer_func_rtc_callback:      The Second callback. It may be NULL_PTR.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              Or any error returned by @fn: timer_init on Timer 2. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 2 is used by another module)
+ */
+sint32_type rtc_init(const struct_rtc_date_time_type* pstr_rtc_date_time, pointer_func_rtc_callback_type pointer_func_rtc_callback)
+{
+    sint32_type         sint32_retval = SUCCESS_RETVAL;
+    tstr_timer_config   str_timer_config;
+    if((pstr_rtc_date_time != NULL_PTR) && (is_valid_date_time(pstr_rtc_date_time) == RTC_TRUE))
+    {
+        gstr_rtc_date_time          = *pstr_rtc_date_time;
+        gpointer_func_rtc_callback  = pointer_func_rtc_callback;
+
+        str_timer_config.enum_timer_index               = TIMER_INDEX_2;
+        str_timer_config.enum_timer_interrupt_usage     = TIMER_USAGE_INTERRUPT;
+        str_timer_config.enum_timer_mode                = TIMER_MODE_OVF;
+        str_timer_config.enum_timer_prescalar_value     = RTC_TIMER_PRESCALAR;
+        str_timer_config.pointer_func_timer_callback    = rtc_second_callback;
+        str_timer_config.enum_timer_pwm_resolution      = TIMER_PWM_RESOLUTION_8_BITS;
+        str_timer_config.enum_timer_clock_source        = TIMER_CLOCK_SOURCE_ASYNC_CRYSTAL;
+        sint32_retval = timer_init(&str_timer_config);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            sint32_retval = timer_enable(TIMER_INDEX_2);
+            if(sint32_retval == SUCCESS_RETVAL)
+            {
+                guint8_is_module_initialized = RTC_TRUE;
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to set the Date and Time. The current second restarts from 0.
+ *
+ * @param[in]   pstr_rtc_date_time:     Address of the new Date and Time.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: rtc_init before.
+ */
+sint32_type rtc_set_date_time(const struct_rtc_date_time_type* pstr_rtc_date_time)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == RTC_TRUE)
+    {
+        if((pstr_rtc_date_time != NULL_PTR) && (is_valid_date_time(pstr_rtc_date_time) == RTC_TRUE))
+        {
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            /*TCNT2 shall not be written while a previous write is moved to the asynchronous clock domain.*/
+            while(GET_BIT(REG_ASSR, TCN2UB_BIT) != 0)
+            {
+                /*Wait for the crystal clock.*/
+            }
+            /*The prescalar is reset with the counter. So the first second is a whole second. PSR2 stays set till the reset is done in the crystal clock domain.*/
+            REG_TCNT2 = 0;
+            SET_BIT(REG_SFIOR, PSR2_BIT);
+            while((GET_BIT(REG_ASSR, TCN2UB_BIT) != 0) || (GET_BIT(REG_SFIOR, PSR2_BIT) != 0))
+            {
+                /*Wait for the crystal clock.*/
+            }
+            /*An overflow of the old second may be pending. It's cleared by writing 1 to its flag. So the new second is not ended by it.*/
+            REG_TIFR            = (uint8_type)(1 << TOV2_BIT);
+            gstr_rtc_date_time  = *pstr_rtc_date_time;
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to read the Date and Time.
+ *
+ * @param[out]  pstr_rtc_date_time:     Address of a structure in which the Date and Time will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: rtc_init before.
+ */
+sint32_type rtc_get_date_time(struct_rtc_date_time_type* pstr_rtc_date_time)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == RTC_TRUE)
+    {
+        if(pstr_rtc_date_time != NULL_PTR)
+        {
+            /*The calendar is updated by the ISR. So it's copied with the interrupts disabled to get one consistent second.*/
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            *pstr_rtc_date_time = gstr_rtc_date_time;
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to put the CPU in the Power Save Sleep. Only Timer 2 and the external interrupts keep running.
+ *              It returns after the CPU is woken up by an interrupt. (At most one second later by the Real Time Clock)
+ * @note:       The CPU clock is stopped. So the timers clocked from the CPU (Ex: The Time Base of @ref: timestamp.h) don't count while sleeping.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: rtc_init before.
+ */
+sint32_type rtc_power_save_sleep(void)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == RTC_TRUE)
+    {
+        /*  The Timer 2 Interrupt logic needs one crystal cycle after a wake up. If the CPU sleeps again before it, the next overflow doesn't wake it up.
+            So a dummy value is written to TCCR2 and the CPU waits until it's moved to the asynchronous clock domain.*/
+        REG_TCCR2 = REG_TCCR2;
+        while(GET_BIT(REG_ASSR, TCR2UB_BIT) != 0)
+        {
+            /*Wait for the crystal clock.*/
+        }
+
+        uint8_sreg = REG_SREG;
+        cli();
+        REG_MCUCR = (REG_MCUCR & (uint8_type)(~REG_MCUCR_SLEEP_BITS_MASK)) | (1<<SE_BIT) | (1<<SM1_BIT) | (1<<SM0_BIT);
+        /*The instruction after sei is executed before any pending interrupt. So the wake up can't be lost.*/
+        sei();
+        sleep_cpu();
+        cli();
+        REG_MCUCR &= (uint8_type)(~REG_MCUCR_SLEEP_BITS_MASK);
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file:           rtc.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration and the needed types of the Real Time Clock.
+ *                  Timer 2 is clocked asynchronously from a 32.768 KHz Watch Crystal on TOSC1 and TOSC2 (PC6, PC7) and overflows once per second.
+ *                  So the calendar keeps running in the Power Save Sleep and the CPU can sleep between the seconds.
+ * @note:           Timer 2 is owned by this module after @ref: rtc_init. PC6 and PC7 can't be used as GPIO(s).
+ */
+
+#ifndef __RTC_H__
+#define __RTC_H__
+
+#include "types.h"
+
+/**
+ * @struct: struct_rtc_date_time_type
+ * @brief:  The Calendar Date and Time. The Leap Years follow the Gregorian Calendar.
+ */
+typedef struct
+{
+    uint16_type     uint16_year;
+    uint8_type      uint8_month;        /*From 1 to 12*/
+    uint8_type      uint8_day;          /*From 1 to the number of days of the month*/
+    uint8_type      uint8_hour;         /*From 0 to 23*/
+    uint8_type      uint8_minute;       /*From 0 to 59*/
+    uint8_type      uint8_second;       /*From 0 to 59*/
+}struct_rtc_date_time_type;
+
+/**
+ * @typedef:    pointer_func_rtc_callback_type
+ * @brief:      Defining of the type of the Second callback. It's called from the TIMER2_OVF ISR after the calendar is updated. So it shall be short.
+ */
+typedef void (*pointer_func_rtc_callback_type)(void);
+
+/**
+ * @brief:      Function that is used to switch Timer 2 to the Watch Crystal and start the Real Time Clock.
+ * @note:       The crystal takes up to one second to be stable after the power up. So the first second may be longer.
+ *
+ * @param[in]   pstr_rtc_date_time:             Address of the initial Date and Time.
+ * @param[in]   pointer_func_rtc_callback:      The Second callback. It may be NULL_PTR.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              Or any error returned by @fn: timer_init on Timer 2. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 2 is used by another module)
+ */
+sint32_type rtc_init(const struct_rtc_date_time_type* pstr_rtc_date_time, pointer_func_rtc_callback_type pointer_func_rtc_callback);
+
+/**
+ * @brief:      Function that is used to set the Date and Time. The current second restarts from 0.
+ *
+ * @param[in]   pstr_rtc_date_time:     Address of the new Date and Time.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: rtc_init before.
+ */
+sint32_type rtc_set_date_time(const struct_rtc_date_time_type* pstr_rtc_date_time);
+
+/**
+ * @brief:      Function that is used to read the Date and Time.
+ *
+ * @param[out]  pstr_rtc_date_time:     Address of a structure in which the Date and Time will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: rtc_init before.
+ */
+sint32_type rtc_get_date_time(struct_rtc_date_time_type* pstr_rtc_date_time);
+
+/**
+ * @brief:      Function that is used to put the CPU in the Power Save Sleep. Only Timer 2 and the external interrupts keep running.
+ *              It returns after the CPU is woken up by an interrupt. (At most one second later by the Real Time Clock)
+ * @note:       The CPU clock is stopped. So the timers clocked from the CPU (Ex: The Time Base of @ref: timestamp.h) don't count while sleeping.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: rtc_init before.
+ */
+sint32_type rtc_power_save_sleep(void);
+
+#endif  /*__RTC_H__*/
@@ -0,0 +1,350 @@
+/**
+ * @file:       scheduler.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Cooperative Run to Completion Scheduler.
+ * @version:    1.0
+ * @date:       2022-08-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "scheduler.h"
+#include "timestamp.h"
+#include "timer.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#define SCHEDULER_FALSE                 0
+#define SCHEDULER_TRUE                  1
+
+#define SE_BIT                          7   /*Bit Index inside the REG_MCUCR*/
+#define I_BIT                           7   /*Bit Index inside the REG_SREG*/
+
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_MCUCR_SLEEP_BITS_MASK (SE and SM2:0 Bits. Written as 0 for the Idle Sleep)
+ *
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| 1     | 1     | 1     | 1     | 0     | 0     |  0    | 0     |
+|---------------------------------------------------------------|
+*/
+#define REG_MCUCR_SLEEP_BITS_MASK       0xF0
+#define MCUCR_SLEEP_MODE_IDLE           0x00    /*SM2:0 = 000*/
+
+/*The periods are kept in Ticks as signed differences. So they shall be less than 2^31 Ticks.*/
+#define SCHEDULER_MAX_PERIOD_IN_US      (0x7FFFFFFFUL >> TIMESTAMP_TICKS_PER_US_SHIFT)
+
+/*The CPU doesn't sleep when the next release is nearer than this. The Compare Match may pass before the sleep instruction.*/
+#define SCHEDULER_MIN_SLEEP_TICKS       64
+
+#define SCHEDULER_NO_TASK               0xFF
+#define SCHEDULER_IDLE_PRIORITY         (-1)
+
+/**
+ * @brief:  Run Time State of one Task. All the times are in Ticks of the Time Base.
+ */
+typedef struct
+{
+    uint32_type     uint32_period_in_ticks;
+    uint32_type     uint32_next_release_in_ticks;
+    uint32_type     uint32_worst_case_execution_time_in_ticks;
+    uint32_type     uint32_number_of_runs;
+    uint16_type     uint16_number_of_deadline_misses;
+    uint8_type      uint8_is_running;
+}struct_scheduler_task_state_type;
+
+static const struct_scheduler_task_config_type* gparr_str_scheduler_task_config     = NULL_PTR;
+static struct_scheduler_task_state_type         garr_str_scheduler_task_state[SCHEDULER_MAX_NUMBER_OF_TASKS];
+static uint8_type                               guint8_number_of_tasks              = 0;
+static pointer_func_scheduler_idle_hook_type    gpointer_func_scheduler_idle_hook   = NULL_PTR;
+static sint16_type                              gsint16_running_priority            = SCHEDULER_IDLE_PRIORITY;
+static uint8_type                               guint8_is_module_initialized        = SCHEDULER_FALSE;
+
+static void         scheduler_wake_up_callback(enum_timer_index_type enum_timer_index);
+static uint8_type   find_ready_task(uint32_type uint32_now_in_ticks, sint16_type sint16_minimum_priority);
+static void         run_task(uint8_type uint8_task_index);
+static void         add_deadline_misses(struct_scheduler_task_state_type* pstr_task_state, uint32_type uint32_number_of_misses);
+static void         sleep_until_next_release(void);
+
+/**
+ * @brief:  Timer 1 Compare Match B callback. It has nothing to do. The interrupt itself wakes up the CPU.
+ * @return  None
+ */
+static void scheduler_wake_up_callback(enum_timer_index_type enum_timer_index)
+{
+    (void)enum_timer_index;
+}
+
+/**
+ * @brief:  Function that is used to find the released task with the highest priority above the minimum priority.
+ *          The tasks that are already running (Preempted by @ref: scheduler_yield) are skipped.
+ * @return  The Index of the Task or SCHEDULER_NO_TASK.
+ */
+static uint8_type find_ready_task(uint32_type uint32_now_in_ticks, sint16_type sint16_minimum_priority)
+{
+    uint8_type  uint8_ready_task_index  = SCHEDULER_NO_TASK;
+    sint16_type sint16_ready_priority   = sint16_minimum_priority;
+    uint8_type  uint8_iterator          = 0;
+    for(uint8_iterator = 0; uint8_iterator < guint8_number_of_tasks; uint8_iterator++)
+    {
+        if  (
+                (garr_str_scheduler_task_state[uint8_iterator].uint8_is_running == SCHEDULER_FALSE) &&
+                ((sint16_type)gparr_str_scheduler_task_config[uint8_iterator].uint8_priority > sint16_ready_priority) &&
+                ((sint32_type)(uint32_now_in_ticks - garr_str_scheduler_task_state[uint8_iterator].uint32_next_release_in_ticks) >= 0)
+            )
+        {
+            uint8_ready_task_index  = uint8_iterator;
+            sint16_ready_priority   = (sint16_type)gparr_str_scheduler_task_config[uint8_iterator].uint8_priority;
+        }
+    }
+    return uint8_ready_task_index;
+}
+
+/**
+ * @brief:  Function that is used to add deadline misses with saturation.
+ * @return  None
+ */
+static void add_deadline_misses(struct_scheduler_task_state_type* pstr_task_state, uint32_type uint32_number_of_misses)
+{
+    if(uint32_number_of_misses > (uint32_type)(0xFFFF - pstr_task_state->uint16_number_of_deadline_misses))
+    {
+        pstr_task_state->uint16_number_of_deadline_misses = 0xFFFF;
+    }
+    else
+    {
+        pstr_task_state->uint16_number_of_deadline_misses += (uint16_type)uint32_number_of_misses;
+    }
+}
+
+/**
+ * @brief:  Function that is used to run one task to completion and update its statistics and its next release.
+ * @return  None
+ */
+static void run_task(uint8_type uint8_task_index)
+{
+    struct_scheduler_task_state_type*   pstr_task_state         = &garr_str_scheduler_task_state[uint8_task_index];
+    sint16_type                         sint16_previous_priority = gsint16_running_priority;
+    uint32_type                         uint32_release_in_ticks = pstr_task_state->uint32_next_release_in_ticks;
+    uint32_type                         uint32_start_in_ticks   = 0;
+    uint32_type                         uint32_end_in_ticks     = 0;
+    uint32_type                         uint32_late_in_ticks    = 0;
+
+    pstr_task_state->uint8_is_running   = SCHEDULER_TRUE;
+    gsint16_running_priority            = (sint16_type)gparr_str_scheduler_task_config[uint8_task_index].uint8_priority;
+
+    uint32_start_in_ticks = time_now_ticks();
+    gparr_str_scheduler_task_config[uint8_task_index].pointer_func_scheduler_task();
+    uint32_end_in_ticks = time_now_ticks();
+
+    gsint16_running_priority            = sint16_previous_priority;
+    pstr_task_state->uint8_is_running   = SCHEDULER_FALSE;
+
+    if((uint32_end_in_ticks - uint32_start_in_ticks) > pstr_task_state->uint32_worst_case_execution_time_in_ticks)
+    {
+        pstr_task_state->uint32_worst_case_execution_time_in_ticks = uint32_end_in_ticks - uint32_start_in_ticks;
+    }
+    if(pstr_task_state->uint32_number_of_runs != 0xFFFFFFFFUL)
+    {
+        pstr_task_state->uint32_number_of_runs++;
+    }
+
+    /*  The deadline is the next release. A late run counts one miss.
+        The releases whose deadlines already passed are skipped and counted too. So the phase is kept without a burst of late runs.*/
+    pstr_task_state->uint32_next_release_in_ticks = uint32_release_in_ticks + pstr_task_state->uint32_period_in_ticks;
+    if((sint32_type)(uint32_end_in_ticks - pstr_task_state->uint32_next_release_in_ticks) > 0)
+    {
+        uint32_late_in_ticks = uint32_end_in_ticks - pstr_task_state->uint32_next_release_in_ticks;
+        pstr_task_state->uint32_next_release_in_ticks += (uint32_late_in_ticks / pstr_task_state->uint32_period_in_ticks) * pstr_task_state->uint32_period_in_ticks;
+        add_deadline_misses(pstr_task_state, (uint32_late_in_ticks / pstr_task_state->uint32_period_in_ticks) + 1);
+    }
+}
+
+/**
+ * @brief:  Function that is used to put the CPU in the Idle Sleep until the nearest release.
+ *          The Compare Match B of Timer 1 is set on the release. If the release is more than one Timer 1 period away, the CPU wakes up early and sleeps again.
+ * @return  None
+ */
+static void sleep_until_next_release(void)
+{
+    uint8_type  uint8_sreg                      = 0;
+    uint8_type  uint8_mcucr                     = 0;
+    uint32_type uint32_now_in_ticks             = 0;
+    uint32_type uint32_next_release_in_ticks    = 0;
+    uint8_type  uint8_iterator                  = 0;
+
+    /*The release time is checked with the interrupts disabled. So an interrupt can't release a task between the check and the sleep.*/
+    uint8_sreg = REG_SREG;
+    CLEAR_BIT(REG_SREG, I_BIT);
+    uint32_now_in_ticks             = time_now_ticks();
+    uint32_next_release_in_ticks    = garr_str_scheduler_task_state[0].uint32_next_release_in_ticks;
+    for(uint8_iterator = 1; uint8_iterator < guint8_number_of_tasks; uint8_iterator++)
+    {
+        if((sint32_type)(garr_str_scheduler_task_state[uint8_iterator].uint32_next_release_in_ticks - uint32_next_release_in_ticks) < 0)
+        {
+            uint32_next_release_in_ticks = garr_str_scheduler_task_state[uint8_iterator].uint32_next_release_in_ticks;
+        }
+    }
+
+    if((sint32_type)(uint32_next_release_in_ticks - uint32_now_in_ticks) > SCHEDULER_MIN_SLEEP_TICKS)
+    {
+        timer_set_compare_value(TIMER_INDEX_1, TIMER_COMPARE_CHANNEL_B, (uint16_type)uint32_next_release_in_ticks);
+        uint8_mcucr = REG_MCUCR;
+        REG_MCUCR = (uint8_mcucr & (uint8_type)(~REG_MCUCR_SLEEP_BITS_MASK)) | MCUCR_SLEEP_MODE_IDLE | (1<<SE_BIT);
+        /*The instruction after sei is executed before any pending interrupt. So the wake up can't be lost.*/
+        sei();
+        sleep_cpu();
+        cli();
+        REG_MCUCR = uint8_mcucr;
+    }
+    REG_SREG = uint8_sreg;
+}
+
+/**
+ * @brief:      Function that is used to initialize the Scheduler with a static table of tasks.
+ * @note:       @ref: timestamp_init shall be called before this function.
+ *
+ * @param[in]   parr_str_scheduler_task_config:         Address of the static table of tasks. It shall be valid while the Scheduler runs.
+ * @param[in]   uint8_number_of_tasks:                  Number of tasks in the table. @note: This shall be from 1 to @ref: SCHEDULER_MAX_NUMBER_OF_TASKS
+ * @param[in]   pointer_func_scheduler_idle_hook:       The Idle Hook. It may be NULL_PTR.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case that the Time Base is not initialized.
+ */
+sint32_type scheduler_init(const struct_scheduler_task_config_type* parr_str_scheduler_task_config, uint8_type uint8_number_of_tasks, pointer_func_scheduler_idle_hook_type pointer_func_scheduler_idle_hook)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    uint8_type  uint8_iterator      = 0;
+    uint32_type uint32_now_in_ticks = 0;
+    if  (
+            (parr_str_scheduler_task_config != NULL_PTR) &&
+            (uint8_number_of_tasks != 0) &&
+            (uint8_number_of_tasks <= SCHEDULER_MAX_NUMBER_OF_TASKS)
+        )
+    {
+        for(uint8_iterator = 0; (uint8_iterator < uint8_number_of_tasks) && (sint32_retval == SUCCESS_RETVAL); uint8_iterator++)
+        {
+            if  (
+                    (parr_str_scheduler_task_config[uint8_iterator].pointer_func_scheduler_task == NULL_PTR) ||
+                    (parr_str_scheduler_task_config[uint8_iterator].uint32_period_in_us == 0) ||
+                    (parr_str_scheduler_task_config[uint8_iterator].uint32_period_in_us > SCHEDULER_MAX_PERIOD_IN_US) ||
+                    (parr_str_scheduler_task_config[uint8_iterator].uint32_offset_in_us > SCHEDULER_MAX_PERIOD_IN_US)
+                )
+            {
+                sint32_retval = ERROR_INVALID_ARGUMENTS;
+            }
+        }
+
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            /*The Compare Match B wakes up the CPU from the Idle Sleep on the next release.*/
+            sint32_retval = timer_set_compare_b_callback(TIMER_INDEX_1, scheduler_wake_up_callback);
+        }
+
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            uint32_now_in_ticks = time_now_ticks();
+            for(uint8_iterator = 0; uint8_iterator < uint8_number_of_tasks; uint8_iterator++)
+            {
+                garr_str_scheduler_task_state[uint8_iterator].uint32_period_in_ticks                      = parr_str_scheduler_task_config[uint8_iterator].uint32_period_in_us << TIMESTAMP_TICKS_PER_US_SHIFT;
+                garr_str_scheduler_task_state[uint8_iterator].uint32_next_release_in_ticks                = uint32_now_in_ticks + (parr_str_scheduler_task_config[uint8_iterator].uint32_offset_in_us << TIMESTAMP_TICKS_PER_US_SHIFT);
+                garr_str_scheduler_task_state[uint8_iterator].uint32_worst_case_execution_time_in_ticks   = 0;
+                garr_str_scheduler_task_state[uint8_iterator].uint32_number_of_runs                       = 0;
+                garr_str_scheduler_task_state[uint8_iterator].uint16_number_of_deadline_misses            = 0;
+                garr_str_scheduler_task_state[uint8_iterator].uint8_is_running                            = SCHEDULER_FALSE;
+            }
+            gparr_str_scheduler_task_config     = parr_str_scheduler_task_config;
+            guint8_number_of_tasks              = uint8_number_of_tasks;
+            gpointer_func_scheduler_idle_hook   = pointer_func_scheduler_idle_hook;
+            gsint16_running_priority            = SCHEDULER_IDLE_PRIORITY;
+            guint8_is_module_initialized        = SCHEDULER_TRUE;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to run the Scheduler. It runs the ready task with the highest priority each time.
+ *              When no task is ready, it calls the Idle Hook then puts the CPU in the Idle Sleep until the next release.
+ * @note:       It never returns.
+ *
+ * @return      None
+ */
+void scheduler_run(void)
+{
+    uint8_type uint8_task_index = SCHEDULER_NO_TASK;
+    while(guint8_is_module_initialized == SCHEDULER_TRUE)
+    {
+        uint8_task_index = find_ready_task(time_now_ticks(), SCHEDULER_IDLE_PRIORITY);
+        if(uint8_task_index != SCHEDULER_NO_TASK)
+        {
+            run_task(uint8_task_index);
+        }
+        else
+        {
+            if(gpointer_func_scheduler_idle_hook != NULL_PTR)
+            {
+                gpointer_func_scheduler_idle_hook();
+            }
+            sleep_until_next_release();
+        }
+    }
+}
+
+/**
+ * @brief:      Function that is used to run one ready task with a priority higher than the running task.
+ *              It's called by the blocking code through @ref: SCHEDULER_YIELD. The running task is never re-entered.
+ *
+ * @return      None
+ */
+void scheduler_yield(void)
+{
+    uint8_type uint8_task_index = SCHEDULER_NO_TASK;
+    if(guint8_is_module_initialized == SCHEDULER_TRUE)
+    {
+        uint8_task_index = find_ready_task(time_now_ticks(), gsint16_running_priority);
+        if(uint8_task_index != SCHEDULER_NO_TASK)
+        {
+            run_task(uint8_task_index);
+        }
+    }
+}
+
+/**
+ * @brief:      Function that is used to read the Run Time Statistics of a task.
+ *
+ * @param[in]   uint8_task_index:                   Index of the task in the static table.
+ * @param[out]  pstr_scheduler_task_statistics:     Address of a structure in which the Statistics will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: scheduler_init before.
+ */
+sint32_type scheduler_get_task_statistics(uint8_type uint8_task_index, struct_scheduler_task_statistics_type* pstr_scheduler_task_statistics)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == SCHEDULER_TRUE)
+    {
+        if((uint8_task_index < guint8_number_of_tasks) && (pstr_scheduler_task_statistics != NULL_PTR))
+        {
+            pstr_scheduler_task_statistics->uint32_worst_case_execution_time_in_us  = TIMESTAMP_TICKS_TO_US(garr_str_scheduler_task_state[uint8_task_index].uint32_worst_case_execution_time_in_ticks);
+            pstr_scheduler_task_statistics->uint32_number_of_runs                   = garr_str_scheduler_task_state[uint8_task_index].uint32_number_of_runs;
+            pstr_scheduler_task_statistics->uint16_number_of_deadline_misses        = garr_str_scheduler_task_state[uint8_task_index].uint16_number_of_deadline_misses;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file:           scheduler.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration and the needed types of the Cooperative Scheduler.
+ *                  The tasks are run to completion from a static table. Each task has a period, an offset and a priority.
+ * @note:           The Scheduler uses the Time Base of @ref: timestamp.h and the Compare Match B of Timer 1 to wake up from the Idle Sleep.
+ */
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include "types.h"
+
+#ifndef SCHEDULER_MAX_NUMBER_OF_TASKS
+#define SCHEDULER_MAX_NUMBER_OF_TASKS       8
+#endif
+
+/*  The Drivers call this macro inside their busy waits. So a higher priority task can run while they're blocked.
+    It's empty when the application doesn't use the Scheduler. (USE_SCHEDULER is not defined)*/
+#if defined (USE_SCHEDULER)
+#define SCHEDULER_YIELD()                   scheduler_yield()
+#else
+#define SCHEDULER_YIELD()
+#endif
+
+/**
+ * @typedef:    pointer_func_scheduler_task_type
+ * @brief:      Defining of the type of the Scheduler Task. It shall return after doing one step of its job.
+ */
+typedef void (*pointer_func_scheduler_task_type)(void);
+
+/**
+ * @typedef:    pointer_func_scheduler_idle_hook_type
+ * @brief:      Defining of the type of the Idle Hook. It's called each time no task is ready before the CPU sleeps.
+ */
+typedef void (*pointer_func_scheduler_idle_hook_type)(void);
+
+/**
+ * @struct: struct_scheduler_task_config_type
+ * @brief:  Configurations of one Task in the static table.
+ */
+typedef struct
+{
+    pointer_func_scheduler_task_type    pointer_func_scheduler_task;
+    uint32_type                         uint32_period_in_us;            /*The period is the relative deadline too.*/
+    uint32_type                         uint32_offset_in_us;            /*The delay of the first release. It can be used to spread the tasks with the same period.*/
+    uint8_type                          uint8_priority;                 /*The ready task with the highest value runs first.*/
+}struct_scheduler_task_config_type;
+
+/**
+ * @struct: struct_scheduler_task_statistics_type
+ * @brief:  Run Time Statistics of one Task.
+ */
+typedef struct
+{
+    uint32_type                         uint32_worst_case_execution_time_in_us;     /*It includes the higher priority tasks run by @ref: scheduler_yield inside this task.*/
+    uint32_type                         uint32_number_of_runs;
+    uint16_type                         uint16_number_of_deadline_misses;           /*The runs finished after the next release and the releases that were skipped.*/
+}struct_scheduler_task_statistics_type;
+
+/**
+ * @brief:      Function that is used to initialize the Scheduler with a static table of tasks.
+ * @note:       @ref: timestamp_init shall be called before this function.
+ *
+ * @param[in]   parr_str_scheduler_task_config:         Address of the static table of tasks. It shall be valid while the Scheduler runs.
+ * @param[in]   uint8_number_of_tasks:                  Number of tasks in the table. @note: This shall be from 1 to @ref: SCHEDULER_MAX_NUMBER_OF_TASKS
+ * @param[in]   pointer_func_scheduler_idle_hook:       The Idle Hook. It may be NULL_PTR.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case that the Time Base is not initialized.
+ */
+sint32_type scheduler_init(const struct_scheduler_task_config_type* parr_str_scheduler_task_config, uint8_type uint8_number_of_tasks, pointer_func_scheduler_idle_hook_type pointer_func_scheduler_idle_hook);
+
+/**
+ * @brief:      Function that is used to run the Scheduler. It runs the ready task with the highest priority each time.
+ *              When no task is ready, it calls the Idle Hook then puts the CPU in the Idle Sleep until the next release.
+ * @note:       It never returns.
+ *
+ * @return      None
+ */
+void scheduler_run(void);
+
+/**
+ * @brief:      Function that is used to run one ready task with a priority higher than the running task.
+ *              It's called by the blocking code through @ref: SCHEDULER_YIELD. The running task is never re-entered.
+ *
+ * @return      None
+ */
+void scheduler_yield(void);
+
+/**
+ * @brief:      Function that is used to read the Run Time Statistics of a task.
+ *
+ * @param[in]   uint8_task_index:                   Index of the task in the static table.
+ * @param[out]  pstr_scheduler_task_statistics:     Address of a structure in which the Statistics will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: scheduler_init before.
+ */
+sint32_type scheduler_get_task_statistics(uint8_type uint8_task_index, struct_scheduler_task_statistics_type* pstr_scheduler_task_statistics);
+
+#endif  /*__SCHEDULER_H__*/
@@ -0,0 +1,458 @@
+/**
+ * @file:       soft_timer.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Software Timers using a hashed timer wheel.
+ * @version:    1.0
+ * @date:       2022-08-26
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "soft_timer.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+
+#define SOFT_TIMER_FALSE                0
+#define SOFT_TIMER_TRUE                 1
+
+#define I_BIT                           7   /*Bit Index inside the REG_SREG*/
+
+#define SOFT_TIMER_WHEEL_SIZE           (1U << SOFT_TIMER_WHEEL_SIZE_SHIFT)
+#define SOFT_TIMER_WHEEL_MASK           (SOFT_TIMER_WHEEL_SIZE - 1)
+
+#if (SOFT_TIMER_MAX_NUMBER_OF_TIMERS >= SOFT_TIMER_INVALID_ID)
+#error "SOFT_TIMER_MAX_NUMBER_OF_TIMERS shall be less than SOFT_TIMER_INVALID_ID"
+#endif
+
+/**
+ * @brief:  Node of a Software Timer. The nodes are linked by their IDs (uint8_type) instead of pointers to save RAM.
+ *          The running timers are in a doubly linked list per slot of the wheel. So they're removed in O(1).
+ *          The expired deferred timers are in a FIFO that is emptied by @ref: soft_timer_dispatcher
+ */
+typedef struct
+{
+    pointer_func_soft_timer_callback_type   pointer_func_soft_timer_callback;
+    uint32_type                             uint32_period_in_ticks;
+    uint32_type                             uint32_remaining_rounds;    /*Number of full turns of the wheel left before the expiry*/
+    enum_soft_timer_mode_type               enum_soft_timer_mode;
+    enum_soft_timer_dispatch_type           enum_soft_timer_dispatch;
+    uint8_type                              uint8_slot;
+    uint8_type                              uint8_next;
+    uint8_type                              uint8_previous;
+    uint8_type                              uint8_pending_next;
+    uint8_type                              uint8_is_allocated;
+    uint8_type                              uint8_is_running;
+    uint8_type                              uint8_is_pending;           /*The deferred callback shall be called*/
+    uint8_type                              uint8_is_expired;           /*Collected by the current tick. It's cleared by @ref: soft_timer_stop and @ref: soft_timer_start to cancel the expiry*/
+    uint8_type                              uint8_is_in_pending_list;   /*The node is linked in the FIFO. It may be cancelled by @ref: soft_timer_stop*/
+}struct_soft_timer_node_type;
+
+static struct_soft_timer_node_type  garr_str_soft_timer_nodes[SOFT_TIMER_MAX_NUMBER_OF_TIMERS];
+static uint8_type                   garr_uint8_wheel_slots[SOFT_TIMER_WHEEL_SIZE];
+static uint8_type                   guint8_wheel_cursor             = 0;
+static uint8_type                   guint8_pending_head             = SOFT_TIMER_INVALID_ID;
+static uint8_type                   guint8_pending_tail             = SOFT_TIMER_INVALID_ID;
+static uint8_type                   guint8_is_module_initialized    = SOFT_TIMER_FALSE;
+
+static void insert_in_wheel(uint8_type uint8_timer_id, uint32_type uint32_period_in_ticks);
+static void remove_from_wheel(uint8_type uint8_timer_id);
+static void add_to_pending_list(uint8_type uint8_timer_id);
+static void soft_timer_tick(enum_timer_index_type enum_timer_index);
+
+/**
+ * @brief:  Function that is used to link a timer in the slot that the cursor reaches after the period.
+ *          The periods longer than the wheel are handled by the rounds counter.
+ * @note:   It shall be called with the interrupts disabled.
+ * @return  None
+ */
+static void insert_in_wheel(uint8_type uint8_timer_id, uint32_type uint32_period_in_ticks)
+{
+    struct_soft_timer_node_type* pstr_node = &garr_str_soft_timer_nodes[uint8_timer_id];
+    uint8_type uint8_slot = (uint8_type)((guint8_wheel_cursor + uint32_period_in_ticks) & SOFT_TIMER_WHEEL_MASK);
+
+    pstr_node->uint32_remaining_rounds  = (uint32_period_in_ticks - 1) >> SOFT_TIMER_WHEEL_SIZE_SHIFT;
+    pstr_node->uint8_slot               = uint8_slot;
+    pstr_node->uint8_previous           = SOFT_TIMER_INVALID_ID;
+    pstr_node->uint8_next               = garr_uint8_wheel_slots[uint8_slot];
+    if(pstr_node->uint8_next != SOFT_TIMER_INVALID_ID)
+    {
+        garr_str_soft_timer_nodes[pstr_node->uint8_next].uint8_previous = uint8_timer_id;
+    }
+    garr_uint8_wheel_slots[uint8_slot]  = uint8_timer_id;
+    pstr_node->uint8_is_running         = SOFT_TIMER_TRUE;
+}
+
+/**
+ * @brief:  Function that is used to unlink a running timer from its slot.
+ * @note:   It shall be called with the interrupts disabled.
+ * @return  None
+ */
+static void remove_from_wheel(uint8_type uint8_timer_id)
+{
+    struct_soft_timer_node_type* pstr_node = &garr_str_soft_timer_nodes[uint8_timer_id];
+    if(pstr_node->uint8_previous != SOFT_TIMER_INVALID_ID)
+    {
+        garr_str_soft_timer_nodes[pstr_node->uint8_previous].uint8_next = pstr_node->uint8_next;
+    }
+    else
+    {
+        garr_uint8_wheel_slots[pstr_node->uint8_slot] = pstr_node->uint8_next;
+    }
+    if(pstr_node->uint8_next != SOFT_TIMER_INVALID_ID)
+    {
+        garr_str_soft_timer_nodes[pstr_node->uint8_next].uint8_previous = pstr_node->uint8_previous;
+    }
+    pstr_node->uint8_is_running = SOFT_TIMER_FALSE;
+}
+
+/**
+ * @brief:  Function that is used to request the deferred callback of a timer. A node is linked in the FIFO once only.
+ * @note:   It shall be called with the interrupts disabled.
+ * @return  None
+ */
+static void add_to_pending_list(uint8_type uint8_timer_id)
+{
+    struct_soft_timer_node_type* pstr_node = &garr_str_soft_timer_nodes[uint8_timer_id];
+    pstr_node->uint8_is_pending = SOFT_TIMER_TRUE;
+    if(pstr_node->uint8_is_in_pending_list == SOFT_TIMER_FALSE)
+    {
+        pstr_node->uint8_is_in_pending_list = SOFT_TIMER_TRUE;
+        pstr_node->uint8_pending_next       = SOFT_TIMER_INVALID_ID;
+        if(guint8_pending_tail != SOFT_TIMER_INVALID_ID)
+        {
+            garr_str_soft_timer_nodes[guint8_pending_tail].uint8_pending_next = uint8_timer_id;
+        }
+        else
+        {
+            guint8_pending_head = uint8_timer_id;
+        }
+        guint8_pending_tail = uint8_timer_id;
+    }
+}
+
+/**
+ * @brief:  The hardware timer callback. It advances the cursor by one slot and visits the timers of this slot only.
+ *          The expired timers are collected first then their callbacks are called.
+ *          So a callback that starts or stops a timer can't corrupt the slot that is being visited.
+ *          Each collected timer is checked again before its callback. So a timer stopped by an earlier callback of the same tick is not reported.
+ * @return  None
+ */
+static void soft_timer_tick(enum_timer_index_type enum_timer_index)
+{
+    uint8_type  arr_uint8_expired_timers[SOFT_TIMER_MAX_NUMBER_OF_TIMERS];
+    uint8_type  uint8_number_of_expired_timers  = 0;
+    uint8_type  uint8_iterator                  = 0;
+    uint8_type  uint8_timer_id                  = SOFT_TIMER_INVALID_ID;
+    uint8_type  uint8_next_timer_id             = SOFT_TIMER_INVALID_ID;
+    struct_soft_timer_node_type* pstr_node      = NULL_PTR;
+    (void)enum_timer_index;
+
+    guint8_wheel_cursor = (guint8_wheel_cursor + 1) & SOFT_TIMER_WHEEL_MASK;
+    uint8_timer_id      = garr_uint8_wheel_slots[guint8_wheel_cursor];
+    while(uint8_timer_id != SOFT_TIMER_INVALID_ID)
+    {
+        pstr_node           = &garr_str_soft_timer_nodes[uint8_timer_id];
+        uint8_next_timer_id = pstr_node->uint8_next;
+        if(pstr_node->uint32_remaining_rounds == 0)
+        {
+            remove_from_wheel(uint8_timer_id);
+            if(pstr_node->enum_soft_timer_mode == SOFT_TIMER_MODE_PERIODIC)
+            {
+                /*Re-armed from the expiry tick. So the period doesn't drift by the callback execution time.*/
+                insert_in_wheel(uint8_timer_id, pstr_node->uint32_period_in_ticks);
+            }
+            pstr_node->uint8_is_expired = SOFT_TIMER_TRUE;
+            arr_uint8_expired_timers[uint8_number_of_expired_timers] = uint8_timer_id;
+            uint8_number_of_expired_timers++;
+        }
+        else
+        {
+            pstr_node->uint32_remaining_rounds--;
+        }
+        uint8_timer_id = uint8_next_timer_id;
+    }
+
+    for(uint8_iterator = 0; uint8_iterator < uint8_number_of_expired_timers; uint8_iterator++)
+    {
+        uint8_timer_id  = arr_uint8_expired_timers[uint8_iterator];
+        pstr_node       = &garr_str_soft_timer_nodes[uint8_timer_id];
+        /*A previous callback of this tick may have stopped, restarted or deleted this timer. Then its expiry is cancelled.*/
+        if((pstr_node->uint8_is_allocated == SOFT_TIMER_TRUE) && (pstr_node->uint8_is_expired == SOFT_TIMER_TRUE))
+        {
+            pstr_node->uint8_is_expired = SOFT_TIMER_FALSE;
+            if(pstr_node->enum_soft_timer_dispatch == SOFT_TIMER_DISPATCH_IN_ISR)
+            {
+                pstr_node->pointer_func_soft_timer_callback(uint8_timer_id);
+            }
+            else
+            {
+                add_to_pending_list(uint8_timer_id);
+            }
+        }
+    }
+}
+
+/**
+ * @brief:      Function that is used to initialize the Software Timers and start the hardware tick.
+ *
+ * @param[in]   pstr_soft_timer_config: Address of the Software Timers Configurations.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_ALREADY_INITAILIZED: In case that this function is called before.
+ *              Or any error returned by @fn: timer_init or @fn: timer_delay on the hardware timer.
+ */
+sint32_type soft_timer_init(const struct_soft_timer_config_type* pstr_soft_timer_config)
+{
+    sint32_type         sint32_retval   = SUCCESS_RETVAL;
+    uint8_type          uint8_iterator  = 0;
+    tstr_timer_config   str_timer_config;
+    if((pstr_soft_timer_config != NULL_PTR) && (pstr_soft_timer_config->uint32_tick_in_ms != 0))
+    {
+        if(guint8_is_module_initialized == SOFT_TIMER_FALSE)
+        {
+            for(uint8_iterator = 0; uint8_iterator < SOFT_TIMER_MAX_NUMBER_OF_TIMERS; uint8_iterator++)
+            {
+                garr_str_soft_timer_nodes[uint8_iterator].uint8_is_allocated       = SOFT_TIMER_FALSE;
+                garr_str_soft_timer_nodes[uint8_iterator].uint8_is_running         = SOFT_TIMER_FALSE;
+                garr_str_soft_timer_nodes[uint8_iterator].uint8_is_pending         = SOFT_TIMER_FALSE;
+                garr_str_soft_timer_nodes[uint8_iterator].uint8_is_expired         = SOFT_TIMER_FALSE;
+                garr_str_soft_timer_nodes[uint8_iterator].uint8_is_in_pending_list = SOFT_TIMER_FALSE;
+            }
+            for(uint8_iterator = 0; uint8_iterator < SOFT_TIMER_WHEEL_SIZE; uint8_iterator++)
+            {
+                garr_uint8_wheel_slots[uint8_iterator] = SOFT_TIMER_INVALID_ID;
+            }
+            guint8_wheel_cursor = 0;
+            guint8_pending_head = SOFT_TIMER_INVALID_ID;
+            guint8_pending_tail = SOFT_TIMER_INVALID_ID;
+
+            /*The hardware timer runs in CTC mode with a periodic delay. So the fraction of a Timer Tick is carried from tick to tick and the tick doesn't drift.*/
+            str_timer_config.enum_timer_index               = pstr_soft_timer_config->enum_timer_index;
+            str_timer_config.enum_timer_interrupt_usage     = TIMER_USAGE_INTERRUPT;
+            str_timer_config.enum_timer_mode                = TIMER_MODE_CTC;
+            str_timer_config.enum_timer_prescalar_value     = pstr_soft_timer_config->enum_timer_prescalar_value;
+            str_timer_config.pointer_func_timer_callback    = soft_timer_tick;
+            str_timer_config.enum_timer_pwm_resolution      = TIMER_PWM_RESOLUTION_8_BITS;
+            str_timer_config.enum_timer_clock_source        = TIMER_CLOCK_SOURCE_CPU;
+            sint32_retval = timer_init(&str_timer_config);
+            if(sint32_retval == SUCCESS_RETVAL)
+            {
+                sint32_retval = timer_delay(pstr_soft_timer_config->enum_timer_index, pstr_soft_timer_config->uint32_tick_in_ms, TIMER_DELAY_PERIODIC);
+                if(sint32_retval == SUCCESS_RETVAL)
+                {
+                    guint8_is_module_initialized = SOFT_TIMER_TRUE;
+                }
+                else
+                {
+                    timer_deinit(pstr_soft_timer_config->enum_timer_index);
+                }
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_MODULE_ALREADY_INITAILIZED;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to allocate a Software Timer from the static pool. The timer is created stopped.
+ *
+ * @param[in]   enum_soft_timer_mode:           One Shot or Periodic.
+ * @param[in]   enum_soft_timer_dispatch:       The context in which the callback is called.
+ * @param[in]   pointer_func_soft_timer_callback: The callback of the timer.
+ * @param[out]  puint8_timer_id:                Address of a variable in which the ID of the timer will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: soft_timer_init before.
+ *              ERROR_OUT_OF_BOUNDARY: In case that all the @ref: SOFT_TIMER_MAX_NUMBER_OF_TIMERS are allocated.
+ */
+sint32_type soft_timer_create(enum_soft_timer_mode_type enum_soft_timer_mode, enum_soft_timer_dispatch_type enum_soft_timer_dispatch, pointer_func_soft_timer_callback_type pointer_func_soft_timer_callback, uint8_type* puint8_timer_id)
+{
+    sint32_type sint32_retval   = ERROR_OUT_OF_BOUNDARY;
+    uint8_type  uint8_iterator  = 0;
+    uint8_type  uint8_sreg      = 0;
+    if  (
+            (enum_soft_timer_mode < SOFT_TIMER_MODE_INVALID) &&
+            (enum_soft_timer_dispatch < SOFT_TIMER_DISPATCH_INVALID) &&
+            (pointer_func_soft_timer_callback != NULL_PTR) &&
+            (puint8_timer_id != NULL_PTR)
+        )
+    {
+        if(guint8_is_module_initialized == SOFT_TIMER_TRUE)
+        {
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            for(uint8_iterator = 0; (uint8_iterator < SOFT_TIMER_MAX_NUMBER_OF_TIMERS) && (sint32_retval != SUCCESS_RETVAL); uint8_iterator++)
+            {
+                if(garr_str_soft_timer_nodes[uint8_iterator].uint8_is_allocated == SOFT_TIMER_FALSE)
+                {
+                    garr_str_soft_timer_nodes[uint8_iterator].uint8_is_allocated                = SOFT_TIMER_TRUE;
+                    garr_str_soft_timer_nodes[uint8_iterator].uint8_is_pending                  = SOFT_TIMER_FALSE;
+                    garr_str_soft_timer_nodes[uint8_iterator].uint8_is_expired                  = SOFT_TIMER_FALSE;
+                    garr_str_soft_timer_nodes[uint8_iterator].enum_soft_timer_mode              = enum_soft_timer_mode;
+                    garr_str_soft_timer_nodes[uint8_iterator].enum_soft_timer_dispatch          = enum_soft_timer_dispatch;
+                    garr_str_soft_timer_nodes[uint8_iterator].pointer_func_soft_timer_callback  = pointer_func_soft_timer_callback;
+                    *puint8_timer_id = uint8_iterator;
+                    sint32_retval = SUCCESS_RETVAL;
+                }
+            }
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to return a Software Timer to the static pool. The timer is stopped first.
+ *
+ * @param[in]   uint8_timer_id: The ID of the timer.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case that the ID is not allocated.
+ */
+sint32_type soft_timer_delete(uint8_type uint8_timer_id)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    sint32_retval = soft_timer_stop(uint8_timer_id);
+    if(sint32_retval == SUCCESS_RETVAL)
+    {
+        /*The node may stay linked in the FIFO. It's skipped by the dispatcher as it's not pending.*/
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_allocated = SOFT_TIMER_FALSE;
+        REG_SREG = uint8_sreg;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to start or restart a Software Timer. A running timer is restarted with the new period.
+ *
+ * @param[in]   uint8_timer_id:         The ID of the timer.
+ * @param[in]   uint32_period_in_ticks: The period in ticks of the wheel. @note: This shall not be 0.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type soft_timer_start(uint8_type uint8_timer_id, uint32_type uint32_period_in_ticks)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if  (
+            (uint8_timer_id < SOFT_TIMER_MAX_NUMBER_OF_TIMERS) &&
+            (uint32_period_in_ticks != 0) &&
+            (garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_allocated == SOFT_TIMER_TRUE)
+        )
+    {
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        if(garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_running == SOFT_TIMER_TRUE)
+        {
+            remove_from_wheel(uint8_timer_id);
+        }
+        garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_expired       = SOFT_TIMER_FALSE;
+        garr_str_soft_timer_nodes[uint8_timer_id].uint32_period_in_ticks = uint32_period_in_ticks;
+        insert_in_wheel(uint8_timer_id, uint32_period_in_ticks);
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to stop a Software Timer. A deferred callback that is pending is cancelled too.
+ *
+ * @param[in]   uint8_timer_id: The ID of the timer.
+ * @return      SUCCESS_RETVAL: In case of success, or in case that the timer is already stopped.
+ *              ERROR_INVALID_ARGUMENTS: In case that the ID is not allocated.
+ */
+sint32_type soft_timer_stop(uint8_type uint8_timer_id)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if  (
+            (uint8_timer_id < SOFT_TIMER_MAX_NUMBER_OF_TIMERS) &&
+            (garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_allocated == SOFT_TIMER_TRUE)
+        )
+    {
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        if(garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_running == SOFT_TIMER_TRUE)
+        {
+            remove_from_wheel(uint8_timer_id);
+        }
+        garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_pending = SOFT_TIMER_FALSE;
+        garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_expired = SOFT_TIMER_FALSE;
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to call the pending callbacks of the timers with SOFT_TIMER_DISPATCH_DEFERRED.
+ *              It shall be called periodically from the main loop.
+ * @note:       A timer that expires again before its callback is called is reported once.
+ *
+ * @return      None
+ */
+void soft_timer_dispatcher(void)
+{
+    uint8_type                              uint8_timer_id      = SOFT_TIMER_INVALID_ID;
+    uint8_type                              uint8_is_pending    = SOFT_TIMER_FALSE;
+    uint8_type                              uint8_sreg          = 0;
+    uint8_type                              uint8_iterator      = 0;
+    pointer_func_soft_timer_callback_type   pointer_func_soft_timer_callback = NULL_PTR;
+
+    /*The loop is bounded. So a periodic timer that expires faster than its callback can't lock the main loop.*/
+    for(uint8_iterator = 0; uint8_iterator < SOFT_TIMER_MAX_NUMBER_OF_TIMERS; uint8_iterator++)
+    {
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        uint8_timer_id = guint8_pending_head;
+        if(uint8_timer_id != SOFT_TIMER_INVALID_ID)
+        {
+            guint8_pending_head = garr_str_soft_timer_nodes[uint8_timer_id].uint8_pending_next;
+            if(guint8_pending_head == SOFT_TIMER_INVALID_ID)
+            {
+                guint8_pending_tail = SOFT_TIMER_INVALID_ID;
+            }
+            garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_in_pending_list  = SOFT_TIMER_FALSE;
+            uint8_is_pending                                                    = garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_pending;
+            garr_str_soft_timer_nodes[uint8_timer_id].uint8_is_pending          = SOFT_TIMER_FALSE;
+            pointer_func_soft_timer_callback                                    = garr_str_soft_timer_nodes[uint8_timer_id].pointer_func_soft_timer_callback;
+        }
+        REG_SREG = uint8_sreg;
+
+        if(uint8_timer_id == SOFT_TIMER_INVALID_ID)
+        {
+            break;
+        }
+        else if(uint8_is_pending == SOFT_TIMER_TRUE)
+        {
+            /*Called with the interrupts enabled. So a long callback doesn't delay the tick.*/
+            pointer_func_soft_timer_callback(uint8_timer_id);
+        }
+    }
+}
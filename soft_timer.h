@@ -0,0 +1,128 @@
+/**
+ * @file:           soft_timer.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration and the needed types of the Software Timers.
+ *                  Many virtual timers are multiplexed on one hardware timer tick using a hashed timer wheel.
+ * @note:           Start, Stop and Expiry are O(1). Each tick only visits the timers hashed to the current slot of the wheel.
+ */
+
+#ifndef __SOFT_TIMER_H__
+#define __SOFT_TIMER_H__
+
+#include "types.h"
+#include "timer.h"
+
+/*Number of the statically allocated Software Timers. It shall not exceed 254.*/
+#ifndef SOFT_TIMER_MAX_NUMBER_OF_TIMERS
+#define SOFT_TIMER_MAX_NUMBER_OF_TIMERS     16
+#endif
+
+/*Number of slots of the wheel as a power of 2. The timers longer than the wheel wait for extra rounds.*/
+#ifndef SOFT_TIMER_WHEEL_SIZE_SHIFT
+#define SOFT_TIMER_WHEEL_SIZE_SHIFT         4
+#endif
+
+#define SOFT_TIMER_INVALID_ID               0xFF
+
+/**
+ * @enum:   enum_soft_timer_mode_type
+ * @brief:  Enumeration of the Software Timer modes.
+ */
+typedef enum
+{
+    SOFT_TIMER_MODE_ONE_SHOT = 0,
+    SOFT_TIMER_MODE_PERIODIC,
+    SOFT_TIMER_MODE_INVALID
+}enum_soft_timer_mode_type;
+
+/**
+ * @enum:   enum_soft_timer_dispatch_type
+ * @brief:  Enumeration of the context in which the Software Timer callback is called.
+ */
+typedef enum
+{
+    SOFT_TIMER_DISPATCH_IN_ISR = 0,     /*The callback is called from the tick ISR. It shall be short.*/
+    SOFT_TIMER_DISPATCH_DEFERRED,       /*The callback is called from @ref: soft_timer_dispatcher in the main loop.*/
+    SOFT_TIMER_DISPATCH_INVALID
+}enum_soft_timer_dispatch_type;
+
+/**
+ * @typedef:    pointer_func_soft_timer_callback_type
+ * @brief:      Defining of the type of the Software Timer callback. It's called with the ID of the expired timer.
+ */
+typedef void (*pointer_func_soft_timer_callback_type)(uint8_type uint8_timer_id);
+
+/**
+ * @struct: struct_soft_timer_config_type
+ * @brief:  Configurations of the hardware timer that drives the wheel tick.
+ */
+typedef struct
+{
+    enum_timer_index_type               enum_timer_index;           /*The hardware timer is used in TIMER_MODE_CTC. So it's not available for other usage.*/
+    enum_timer_prescalar_value_type     enum_timer_prescalar_value;
+    uint32_type                         uint32_tick_in_ms;
+}struct_soft_timer_config_type;
+
+/**
+ * @brief:      Function that is used to initialize the Software Timers and start the hardware tick.
+ *
+ * @param[in]   pstr_soft_timer_config: Address of the Software Timers Configurations.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_ALREADY_INITAILIZED: In case that this function is called before.
+ *              Or any error returned by @fn: timer_init or @fn: timer_delay on the hardware timer.
+ */
+sint32_type soft_timer_init(const struct_soft_timer_config_type* pstr_soft_timer_config);
+
+/**
+ * @brief:      Function that is used to allocate a Software Timer from the static pool. The timer is created stopped.
+ *
+ * @param[in]   enum_soft_timer_mode:           One Shot or Periodic.
+ * @param[in]   enum_soft_timer_dispatch:       The context in which the callback is called.
+ * @param[in]   pointer_func_soft_timer_callback: The callback of the timer.
+ * @param[out]  puint8_timer_id:                Address of a variable in which the ID of the timer will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: soft_timer_init before.
+ *              ERROR_OUT_OF_BOUNDARY: In case that all the @ref: SOFT_TIMER_MAX_NUMBER_OF_TIMERS are allocated.
+ */
+sint32_type soft_timer_create(enum_soft_timer_mode_type enum_soft_timer_mode, enum_soft_timer_dispatch_type enum_soft_timer_dispatch, pointer_func_soft_timer_callback_type pointer_func_soft_timer_callback, uint8_type* puint8_timer_id);
+
+/**
+ * @brief:      Function that is used to return a Software Timer to the static pool. The timer is stopped first.
+ *
+ * @param[in]   uint8_timer_id: The ID of the timer.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case that the ID is not allocated.
+ */
+sint32_type soft_timer_delete(uint8_type uint8_timer_id);
+
+/**
+ * @brief:      Function that is used to start or restart a Software Timer. A running timer is restarted with the new period.
+ *
+ * @param[in]   uint8_timer_id:         The ID of the timer.
+ * @param[in]   uint32_period_in_ticks: The period in ticks of the wheel. @note: This shall not be 0.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type soft_timer_start(uint8_type uint8_timer_id, uint32_type uint32_period_in_ticks);
+
+/**
+ * @brief:      Function that is used to stop a Software Timer. A deferred callback that is pending is cancelled too.
+ *
+ * @param[in]   uint8_timer_id: The ID of the timer.
+ * @return      SUCCESS_RETVAL: In case of success, or in case that the timer is already stopped.
+ *              ERROR_INVALID_ARGUMENTS: In case that the ID is not allocated.
+ */
+sint32_type soft_timer_stop(uint8_type uint8_timer_id);
+
+/**
+ * @brief:      Function that is used to call the pending callbacks of the timers with SOFT_TIMER_DISPATCH_DEFERRED.
+ *              It shall be called periodically from the main loop.
+ * @note:       A timer that expires again before its callback is called is reported once.
+ *
+ * @return      None
+ */
+void soft_timer_dispatcher(void);
+
+#endif  /*__SOFT_TIMER_H__*/
@@ -0,0 +1,564 @@
+/**
+ * @file:       stepper.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Stepper Motor Driver with the AVR446 Trapezoidal Speed Profile on Timer 1.
+ * @version:    1.0
+ * @date:       2022-08-31
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "stepper.h"
+#include "timer.h"
+#include "gpio.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+
+#define STEPPER_FALSE                       0
+#define STEPPER_TRUE                        1
+
+#define OCF1A_BIT                           4   /*Bit Index inside the REG_TIFR*/
+#define I_BIT                               7   /*Bit Index inside the REG_SREG*/
+
+/*  The first delay of the AVR446 ramp is c0 = 0.676 * f * sqrt(2 / a) = 0.956 * f / sqrt(a).
+    The factor 0.676 corrects the error of the approximation on the first step. sqrt(a) is calculated with 4 fraction Bits.*/
+#define STEPPER_FIRST_DELAY_FACTOR          956UL
+#define STEPPER_FIRST_DELAY_SCALE           1000UL
+#define STEPPER_SQRT_FRACTION_BITS          4
+#define STEPPER_MAX_STEP_DELAY              0xFFFFUL
+#define STEPPER_RATIO_BITS                  16
+#define STEPPER_RATIO_MAX_OPERAND           0xFFFFUL
+/*The first Compare Match after the start. The first step is done in its ISR and loads the first delay.*/
+#define STEPPER_START_DELAY                 10
+
+/**
+ * @enum:   enum_stepper_state_type
+ * @brief:  The states of the Speed Profile.
+ */
+typedef enum
+{
+    STEPPER_STATE_STOP = 0,
+    STEPPER_STATE_ACCELERATION,
+    STEPPER_STATE_RUN,
+    STEPPER_STATE_DECELERATION,
+    STEPPER_STATE_INVALID
+}enum_stepper_state_type;
+
+/**
+ * @struct: struct_stepper_ramp_type
+ * @brief:  The state of the running move. It's written by @fn: stepper_move while Timer 1 is stopped and by the ISR only after.
+ */
+typedef struct
+{
+    enum_stepper_state_type     enum_stepper_state;
+    sint32_type                 sint32_step_delay;          /*The delay of the next step in Timer Ticks.*/
+    sint32_type                 sint32_min_step_delay;      /*The delay of the Cruise Speed.*/
+    sint32_type                 sint32_last_accel_delay;    /*The delay of the last step of the Acceleration. The Deceleration starts from it.*/
+    sint32_type                 sint32_accel_count;         /*The step index on the ramp. It's negative in the Deceleration and reaches 0 on the last step.*/
+    sint32_type                 sint32_decel_value;         /*The first step index of the Deceleration. (Negative)*/
+    sint32_type                 sint32_rest;                /*The remainder of the last division. It's carried to the next step. So the ramp doesn't drift.*/
+    uint32_type                 uint32_step_count;
+    uint32_type                 uint32_decel_start;
+    sint32_type                 sint32_position;
+    sint8_type                  sint8_direction;
+}struct_stepper_ramp_type;
+
+static volatile struct_stepper_ramp_type    gstr_stepper_ramp;
+static struct_stepper_config_type           gstr_stepper_config;
+static volatile uint8_type                  guint8_is_running               = STEPPER_FALSE;
+static uint8_type                           guint8_is_module_initialized    = STEPPER_FALSE;
+
+static void         stepper_step_callback(enum_timer_index_type enum_timer_index);
+static void         calculate_next_step_delay(void);
+static uint32_type  square_root(uint32_type uint32_value);
+static uint32_type  calculate_first_step_delay(uint32_type uint32_acceleration);
+static uint32_type  calculate_acceleration_limit(uint32_type uint32_number_of_steps, uint32_type uint32_acceleration, uint32_type uint32_deceleration);
+
+/**
+ * @brief:  Function that is used to calculate the delay of the next step on the ramp. c(n) = c(n-1) - (2 * c(n-1) + rest) / (4 * n + 1)
+ *          The quotient is 0 when the numerator is smaller than the denominator. So the division is skipped near the Cruise Speed where the delays are short.
+ * @return  None
+ */
+static void calculate_next_step_delay(void)
+{
+    sint32_type sint32_numerator    = (2 * gstr_stepper_ramp.sint32_step_delay) + gstr_stepper_ramp.sint32_rest;
+    sint32_type sint32_denominator  = (4 * gstr_stepper_ramp.sint32_accel_count) + 1;
+    sint32_type sint32_abs_numerator    = (sint32_numerator < 0) ? -sint32_numerator : sint32_numerator;
+    sint32_type sint32_abs_denominator  = (sint32_denominator < 0) ? -sint32_denominator : sint32_denominator;
+    if(sint32_abs_numerator < sint32_abs_denominator)
+    {
+        gstr_stepper_ramp.sint32_rest = sint32_numerator;
+    }
+    else
+    {
+        gstr_stepper_ramp.sint32_step_delay    -= (sint32_numerator / sint32_denominator);
+        gstr_stepper_ramp.sint32_rest           = (sint32_numerator % sint32_denominator);
+    }
+    /*The approximation of the last steps of a Deceleration may exceed the first delay.*/
+    if(gstr_stepper_ramp.sint32_step_delay > (sint32_type)STEPPER_MAX_STEP_DELAY)
+    {
+        gstr_stepper_ramp.sint32_step_delay = (sint32_type)STEPPER_MAX_STEP_DELAY;
+    }
+}
+
+/**
+ * @brief:  Timer 1 Compare Match A callback. It's called from the ISR on each step.
+ *          The Compare Register is not buffered in TIMER_MODE_CTC and the counter has just been cleared. So the delay of the running step is loaded first.
+ *          Then the step is done and the delay of the next step is calculated while the Step Pin is high.
+ *          The Pin is cleared after more than STEPPER_MIN_PULSE_WIDTH Ticks. (A difference of N Ticks may be N - 1 Ticks of time plus a fraction)
+ * @return  None
+ */
+static void stepper_step_callback(enum_timer_index_type enum_timer_index)
+{
+    uint16_type uint16_pulse_start = 0;
+    REG_OCR1A = (uint16_type)(gstr_stepper_ramp.sint32_step_delay - 1);
+    if(gstr_stepper_ramp.enum_stepper_state == STEPPER_STATE_STOP)
+    {
+        /*The delay of the last step has elapsed.*/
+        timer_disable(enum_timer_index);
+        guint8_is_running = STEPPER_FALSE;
+    }
+    else
+    {
+        uint16_pulse_start = REG_TCNT1;
+        gpio_mainpulate_pin(ENU_OPERATION_SET, gstr_stepper_config.enum_step_port, gstr_stepper_config.uint8_step_pin);
+        gstr_stepper_ramp.sint32_position += gstr_stepper_ramp.sint8_direction;
+        gstr_stepper_ramp.uint32_step_count++;
+        switch(gstr_stepper_ramp.enum_stepper_state)
+        {
+            case STEPPER_STATE_ACCELERATION:
+            {
+                gstr_stepper_ramp.sint32_accel_count++;
+                calculate_next_step_delay();
+                if(gstr_stepper_ramp.uint32_step_count >= gstr_stepper_ramp.uint32_decel_start)
+                {
+                    /*The move is too short to reach the Cruise Speed.*/
+                    gstr_stepper_ramp.sint32_accel_count    = gstr_stepper_ramp.sint32_decel_value;
+                    gstr_stepper_ramp.enum_stepper_state    = STEPPER_STATE_DECELERATION;
+                }
+                else if(gstr_stepper_ramp.sint32_step_delay <= gstr_stepper_ramp.sint32_min_step_delay)
+                {
+                    gstr_stepper_ramp.sint32_last_accel_delay   = gstr_stepper_ramp.sint32_step_delay;
+                    gstr_stepper_ramp.sint32_step_delay         = gstr_stepper_ramp.sint32_min_step_delay;
+                    gstr_stepper_ramp.sint32_rest               = 0;
+                    gstr_stepper_ramp.enum_stepper_state        = STEPPER_STATE_RUN;
+                }
+                break;
+            }
+            case STEPPER_STATE_RUN:
+            {
+                /*The delay is constant. So nothing is calculated in the Cruise.*/
+                if(gstr_stepper_ramp.uint32_step_count >= gstr_stepper_ramp.uint32_decel_start)
+                {
+                    gstr_stepper_ramp.sint32_accel_count    = gstr_stepper_ramp.sint32_decel_value;
+                    gstr_stepper_ramp.sint32_step_delay     = gstr_stepper_ramp.sint32_last_accel_delay;
+                    gstr_stepper_ramp.enum_stepper_state    = STEPPER_STATE_DECELERATION;
+                }
+                break;
+            }
+            case STEPPER_STATE_DECELERATION:
+            {
+                gstr_stepper_ramp.sint32_accel_count++;
+                if(gstr_stepper_ramp.sint32_accel_count >= 0)
+                {
+                    /*The last step is done. The ISR stops the timer after its delay.*/
+                    gstr_stepper_ramp.enum_stepper_state = STEPPER_STATE_STOP;
+                }
+                else
+                {
+                    calculate_next_step_delay();
+                }
+                break;
+            }
+            default:
+            {
+                gstr_stepper_ramp.enum_stepper_state = STEPPER_STATE_STOP;
+                break;
+            }
+        }
+        /*The Cruise steps calculate nothing. So the Driver minimum high time is waited here. The step delay is longer. So the counter doesn't wrap meanwhile.*/
+        while((uint16_type)(REG_TCNT1 - uint16_pulse_start) <= STEPPER_MIN_PULSE_WIDTH)
+        {
+            /*Wait for the minimum pulse width.*/
+        }
+        gpio_mainpulate_pin(ENU_OPERATION_CLEAR, gstr_stepper_config.enum_step_port, gstr_stepper_config.uint8_step_pin);
+    }
+}
+
+/**
+ * @brief:  Function that is used to calculate the integer Square Root by the Bit by Bit method.
+ * @return  floor(sqrt(uint32_value))
+ */
+static uint32_type square_root(uint32_type uint32_value)
+{
+    uint32_type uint32_result   = 0;
+    uint32_type uint32_bit      = (uint32_type)1 << 30;
+    while(uint32_bit > uint32_value)
+    {
+        uint32_bit >>= 2;
+    }
+    while(uint32_bit != 0)
+    {
+        if(uint32_value >= (uint32_result + uint32_bit))
+        {
+            uint32_value   -= (uint32_result + uint32_bit);
+            uint32_result   = (uint32_result >> 1) + uint32_bit;
+        }
+        else
+        {
+            uint32_result >>= 1;
+        }
+        uint32_bit >>= 2;
+    }
+    return uint32_result;
+}
+
+/**
+ * @brief:  Function that is used to calculate the first delay of a ramp in Timer Ticks.
+ * @note:   The Acceleration shall not exceed STEPPER_MAX_ACCELERATION. So (a << 8) fits 32 Bits.
+ * @return  The delay. It may exceed 16 Bits for the low Accelerations.
+ */
+static uint32_type calculate_first_step_delay(uint32_type uint32_acceleration)
+{
+    uint32_type uint32_sqrt_acceleration = square_root(uint32_acceleration << (2 * STEPPER_SQRT_FRACTION_BITS));
+    return (((STEPPER_TIMER_FREQUENCY / STEPPER_FIRST_DELAY_SCALE) * STEPPER_FIRST_DELAY_FACTOR) << STEPPER_SQRT_FRACTION_BITS) / uint32_sqrt_acceleration;
+}
+
+/**
+ * @brief:  Function that is used to calculate the step at which the Acceleration and the Deceleration ramps cross. steps * decel / (accel + decel)
+ *          The ratio is calculated with 16 fraction Bits. So no product overflows 32 Bits. The error is 1 step at most.
+ * @return  The number of steps of the Acceleration ramp of a triangle profile.
+ */
+static uint32_type calculate_acceleration_limit(uint32_type uint32_number_of_steps, uint32_type uint32_acceleration, uint32_type uint32_deceleration)
+{
+    uint32_type uint32_ratio = 0;
+    while((uint32_acceleration + uint32_deceleration) > STEPPER_RATIO_MAX_OPERAND)
+    {
+        uint32_acceleration >>= 1;
+        uint32_deceleration >>= 1;
+    }
+    uint32_ratio = (uint32_deceleration << STEPPER_RATIO_BITS) / (uint32_acceleration + uint32_deceleration);
+    return ((uint32_number_of_steps >> STEPPER_RATIO_BITS) * uint32_ratio) + (((uint32_number_of_steps & STEPPER_RATIO_MAX_OPERAND) * uint32_ratio) >> STEPPER_RATIO_BITS);
+}
+
+/**
+ * @brief:      Function that is used to initialize the Step and the Direction GPIO(s) and Timer 1 in TIMER_MODE_CTC. The motor is stopped.
+ *
+ * @param[in]   pstr_stepper_config:    Address of the Stepper Configurations.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              Or any error returned by @fn: gpio_set_pin_direction or @fn: timer_init on Timer 1. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 1 is used by another module)
+ */
+sint32_type stepper_init(const struct_stepper_config_type* pstr_stepper_config)
+{
+    sint32_type         sint32_retval = SUCCESS_RETVAL;
+    tstr_timer_config   str_timer_config;
+    if(pstr_stepper_config != NULL_PTR)
+    {
+        sint32_retval = gpio_set_pin_direction(pstr_stepper_config->enum_step_port, pstr_stepper_config->uint8_step_pin, ENU_DIRECTION_OUTPUT);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            sint32_retval = gpio_set_pin_direction(pstr_stepper_config->enum_direction_port, pstr_stepper_config->uint8_direction_pin, ENU_DIRECTION_OUTPUT);
+        }
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            gstr_stepper_config = *pstr_stepper_config;
+            gpio_mainpulate_pin(ENU_OPERATION_CLEAR, gstr_stepper_config.enum_step_port, gstr_stepper_config.uint8_step_pin);
+
+            gstr_stepper_ramp.enum_stepper_state    = STEPPER_STATE_STOP;
+            gstr_stepper_ramp.sint32_position       = 0;
+            guint8_is_running                       = STEPPER_FALSE;
+
+            /*The callback is called on each Compare Match. It's the only user of OCR1A.*/
+            str_timer_config.enum_timer_index               = TIMER_INDEX_1;
+            str_timer_config.enum_timer_interrupt_usage     = TIMER_USAGE_INTERRUPT;
+            str_timer_config.enum_timer_mode                = TIMER_MODE_CTC;
+            str_timer_config.enum_timer_prescalar_value     = (enum_timer_prescalar_value_type)STEPPER_PRESCALAR;
+            str_timer_config.pointer_func_timer_callback    = stepper_step_callback;
+            str_timer_config.enum_timer_pwm_resolution      = TIMER_PWM_RESOLUTION_8_BITS;
+            str_timer_config.enum_timer_clock_source        = TIMER_CLOCK_SOURCE_CPU;
+            sint32_retval = timer_init(&str_timer_config);
+            if(sint32_retval == SUCCESS_RETVAL)
+            {
+                guint8_is_module_initialized = STEPPER_TRUE;
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to start a relative move. The motor accelerates to the Speed, cruises and decelerates to stop on the last step.
+ *              In case that the move is too short to reach the Speed, the profile is a triangle and the Deceleration starts at the crossing point.
+ *
+ * @param[in]   sint32_number_of_steps:     The steps to move. The sign is the direction. 0 doesn't move.
+ * @param[in]   uint16_speed:               The Cruise Speed in Steps / Second. @note: This shall not exceed STEPPER_MAX_SPEED.
+ * @param[in]   uint32_acceleration:        The Acceleration in Steps / Second^2. @note: This shall not exceed STEPPER_MAX_ACCELERATION.
+ * @param[in]   uint32_deceleration:        The Deceleration in Steps / Second^2. @note: This shall not exceed STEPPER_MAX_ACCELERATION.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ *              ERROR_MODULE_BUSY: In case that the previous move is not finished.
+ *              ERROR_OUT_OF_BOUNDARY: In case that the Speed exceeds STEPPER_MAX_SPEED or a Step delay doesn't fit 16 Bits. (The Speed or the Acceleration is too low. See @ref: STEPPER_PRESCALAR)
+ */
+sint32_type stepper_move(sint32_type sint32_number_of_steps, uint16_type uint16_speed, uint32_type uint32_acceleration, uint32_type uint32_deceleration)
+{
+    sint32_type sint32_retval               = SUCCESS_RETVAL;
+    uint32_type uint32_number_of_steps      = 0;
+    uint32_type uint32_min_step_delay       = 0;
+    uint32_type uint32_first_accel_delay    = 0;
+    uint32_type uint32_first_decel_delay    = 0;
+    uint32_type uint32_max_speed_limit      = 0;
+    uint32_type uint32_accel_limit          = 0;
+    sint32_type sint32_decel_value          = 0;
+    uint8_type  uint8_sreg                  = 0;
+    if  (
+            (uint16_speed != 0) &&
+            (uint32_acceleration != 0) && (uint32_acceleration <= STEPPER_MAX_ACCELERATION) &&
+            (uint32_deceleration != 0) && (uint32_deceleration <= STEPPER_MAX_ACCELERATION)
+        )
+    {
+        if(guint8_is_module_initialized == STEPPER_FALSE)
+        {
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else if(guint8_is_running == STEPPER_TRUE)
+        {
+            sint32_retval = ERROR_MODULE_BUSY;
+        }
+        else
+        {
+            uint32_min_step_delay       = STEPPER_TIMER_FREQUENCY / uint16_speed;
+            uint32_first_accel_delay    = calculate_first_step_delay(uint32_acceleration);
+            uint32_first_decel_delay    = calculate_first_step_delay(uint32_deceleration);
+            if  (
+                    (uint16_speed > STEPPER_MAX_SPEED) ||
+                    (uint32_min_step_delay > STEPPER_MAX_STEP_DELAY) ||
+                    (uint32_first_accel_delay > STEPPER_MAX_STEP_DELAY) ||
+                    (uint32_first_decel_delay > STEPPER_MAX_STEP_DELAY)
+                )
+            {
+                sint32_retval = ERROR_OUT_OF_BOUNDARY;
+            }
+            else if(sint32_number_of_steps != 0)
+            {
+                if(sint32_number_of_steps > 0)
+                {
+                    uint32_number_of_steps              = (uint32_type)sint32_number_of_steps;
+                    gstr_stepper_ramp.sint8_direction   = 1;
+                    gpio_mainpulate_pin(ENU_OPERATION_SET, gstr_stepper_config.enum_direction_port, gstr_stepper_config.uint8_direction_pin);
+                }
+                else
+                {
+                    uint32_number_of_steps              = (uint32_type)0 - (uint32_type)sint32_number_of_steps;
+                    gstr_stepper_ramp.sint8_direction   = -1;
+                    gpio_mainpulate_pin(ENU_OPERATION_CLEAR, gstr_stepper_config.enum_direction_port, gstr_stepper_config.uint8_direction_pin);
+                }
+
+                gstr_stepper_ramp.sint32_min_step_delay     = (sint32_type)uint32_min_step_delay;
+                gstr_stepper_ramp.sint32_rest               = 0;
+                gstr_stepper_ramp.uint32_step_count         = 0;
+                gstr_stepper_ramp.sint32_accel_count        = 0;
+                if(uint32_number_of_steps == 1)
+                {
+                    /*One step is the last step of a Deceleration.*/
+                    gstr_stepper_ramp.sint32_accel_count    = -1;
+                    gstr_stepper_ramp.sint32_step_delay     = (sint32_type)uint32_first_decel_delay;
+                    gstr_stepper_ramp.enum_stepper_state    = STEPPER_STATE_DECELERATION;
+                }
+                else
+                {
+                    /*The steps to reach the Speed (v^2 / 2a) and the steps of the Acceleration in a triangle profile.*/
+                    uint32_max_speed_limit  = ((uint32_type)uint16_speed * uint16_speed) / (uint32_acceleration << 1);
+                    if(uint32_max_speed_limit == 0)
+                    {
+                        uint32_max_speed_limit = 1;
+                    }
+                    uint32_accel_limit      = calculate_acceleration_limit(uint32_number_of_steps, uint32_acceleration, uint32_deceleration);
+                    if(uint32_accel_limit == 0)
+                    {
+                        uint32_accel_limit = 1;
+                    }
+                    if(uint32_max_speed_limit <= uint32_accel_limit)
+                    {
+                        /*The Deceleration steps are scaled by accel / decel. (v^2 / 2a <= v^2 / 2). So the product fits 32 Bits.*/
+                        sint32_decel_value = -(sint32_type)((uint32_max_speed_limit * uint32_acceleration) / uint32_deceleration);
+                    }
+                    else
+                    {
+                        sint32_decel_value = -(sint32_type)(uint32_number_of_steps - uint32_accel_limit);
+                    }
+                    if(sint32_decel_value == 0)
+                    {
+                        sint32_decel_value = -1;
+                    }
+                    gstr_stepper_ramp.sint32_decel_value    = sint32_decel_value;
+                    gstr_stepper_ramp.uint32_decel_start    = uint32_number_of_steps - (uint32_type)(-sint32_decel_value);
+
+                    if(uint32_first_accel_delay <= uint32_min_step_delay)
+                    {
+                        /*The Speed is reached on the first step.*/
+                        gstr_stepper_ramp.sint32_step_delay         = (sint32_type)uint32_min_step_delay;
+                        gstr_stepper_ramp.sint32_last_accel_delay   = (sint32_type)uint32_min_step_delay;
+                        gstr_stepper_ramp.enum_stepper_state        = STEPPER_STATE_RUN;
+                    }
+                    else
+                    {
+                        gstr_stepper_ramp.sint32_step_delay         = (sint32_type)uint32_first_accel_delay;
+                        gstr_stepper_ramp.enum_stepper_state        = STEPPER_STATE_ACCELERATION;
+                    }
+                }
+
+                /*The first Compare Match comes after a few Ticks. Its ISR does the first step and loads the first delay.*/
+                guint8_is_running   = STEPPER_TRUE;
+                /*The 16 Bits Registers are accessed through the shared TEMP Register. So the Interrupts are disabled.*/
+                uint8_sreg          = REG_SREG;
+                CLEAR_BIT(REG_SREG, I_BIT);
+                REG_TCNT1           = 0;
+                REG_OCR1A           = STEPPER_START_DELAY;
+                REG_SREG            = uint8_sreg;
+                REG_TIFR            = (1<<OCF1A_BIT);
+                sint32_retval       = timer_enable(TIMER_INDEX_1);
+                if(sint32_retval != SUCCESS_RETVAL)
+                {
+                    guint8_is_running = STEPPER_FALSE;
+                }
+            }
+            else
+            {
+                /*Nothing to move.*/
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to stop the motor at once without Deceleration. The steps may be lost at high Speeds.
+ *
+ * @return      SUCCESS_RETVAL: In case of success, or the motor is already stopped.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ */
+sint32_type stepper_stop(void)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == STEPPER_TRUE)
+    {
+        /*A Compare Match may be pending. So its flag is cleared with the interrupts disabled before the ISR can do another step.*/
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        if(guint8_is_running == STEPPER_TRUE)
+        {
+            timer_disable(TIMER_INDEX_1);
+            REG_TIFR                                = (1<<OCF1A_BIT);
+            gstr_stepper_ramp.enum_stepper_state    = STEPPER_STATE_STOP;
+            guint8_is_running                       = STEPPER_FALSE;
+        }
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to check if a move is running.
+ *
+ * @param[out]  puint8_is_running:      Address of a variable in which TRUE or FALSE will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ */
+sint32_type stepper_is_running(uint8_type* puint8_is_running)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == STEPPER_TRUE)
+    {
+        if(puint8_is_running != NULL_PTR)
+        {
+            *puint8_is_running = (guint8_is_running == STEPPER_TRUE) ? TRUE : FALSE;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to read the Position. It's updated on each step. So it can be read while the motor is running.
+ *
+ * @param[out]  psint32_position:       Address of a variable in which the Position in Steps will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ */
+sint32_type stepper_get_position(sint32_type* psint32_position)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(guint8_is_module_initialized == STEPPER_TRUE)
+    {
+        if(psint32_position != NULL_PTR)
+        {
+            /*The 32 Bits Position is updated by the ISR. So it's copied with the interrupts disabled.*/
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            *psint32_position = gstr_stepper_ramp.sint32_position;
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to set the Position. (Ex: 0 after Homing)
+ *
+ * @param[in]   sint32_position:        The new Position in Steps.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ *              ERROR_MODULE_BUSY: In case that a move is running.
+ */
+sint32_type stepper_set_position(sint32_type sint32_position)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(guint8_is_module_initialized == STEPPER_FALSE)
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    else if(guint8_is_running == STEPPER_TRUE)
+    {
+        sint32_retval = ERROR_MODULE_BUSY;
+    }
+    else
+    {
+        gstr_stepper_ramp.sint32_position = sint32_position;
+    }
+    return sint32_retval;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file:           stepper.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration and the needed types of the Stepper Motor Driver.
+ *                  The Step pulses follow a Trapezoidal Speed Profile (Acceleration, Cruise and Deceleration) calculated by the AVR446 integer approximation.
+ *                  Timer 1 runs in TIMER_MODE_CTC and the next step delay is calculated in the Compare Match ISR. So no float is used.
+ * @note:           Timer 1 is owned by this module after @ref: stepper_init. It can't be shared with the Time Base of @ref: timestamp.h
+ */
+
+#ifndef __STEPPER_H__
+#define __STEPPER_H__
+
+#include "types.h"
+#include "gpio.h"
+
+#ifndef F_CPU
+#define F_CPU                               16000000UL
+#endif
+
+/*Timer 1 Prescalar of the Step delays. The lowest Acceleration (And Deceleration) is about (0.956 * F_CPU / (STEPPER_PRESCALAR * 65535))^2 Steps / Second^2.
+  Ex: 852 Steps / Second^2 with 8 and 53 Steps / Second^2 with 64 @ 16 MHz.*/
+#ifndef STEPPER_PRESCALAR
+#define STEPPER_PRESCALAR                   8
+#endif
+
+/*The minimum Step delay in CPU Cycles. The Compare Match ISR shall finish within it. It limits the Speed to 50 KHz @ 16 MHz.*/
+#ifndef STEPPER_MIN_STEP_DELAY_IN_CYCLES
+#define STEPPER_MIN_STEP_DELAY_IN_CYCLES    320
+#endif
+
+/*The minimum high time of the Step Pulse in CPU Cycles. The A4988 needs 1 Micro Second and the DRV8825 needs 1.9 Micro Seconds. (2 Micro Seconds @ 16 MHz)*/
+#ifndef STEPPER_MIN_PULSE_WIDTH_IN_CYCLES
+#define STEPPER_MIN_PULSE_WIDTH_IN_CYCLES   32
+#endif
+
+#define STEPPER_TIMER_FREQUENCY             (F_CPU / STEPPER_PRESCALAR)
+#define STEPPER_MIN_STEP_DELAY              (STEPPER_MIN_STEP_DELAY_IN_CYCLES / STEPPER_PRESCALAR)
+#define STEPPER_MIN_PULSE_WIDTH             ((STEPPER_MIN_PULSE_WIDTH_IN_CYCLES + STEPPER_PRESCALAR - 1) / STEPPER_PRESCALAR)
+#define STEPPER_MAX_SPEED                   (STEPPER_TIMER_FREQUENCY / STEPPER_MIN_STEP_DELAY)
+#define STEPPER_MAX_ACCELERATION            0x00FFFFFFUL
+
+#if ((STEPPER_TIMER_FREQUENCY % 1000UL) != 0)
+#error "F_CPU / STEPPER_PRESCALAR shall be a whole number of KHz"
+#endif
+
+#if (STEPPER_MIN_STEP_DELAY < 2)
+#error "STEPPER_MIN_STEP_DELAY_IN_CYCLES shall be 2 Timer Ticks at least"
+#endif
+
+#if ((STEPPER_MIN_PULSE_WIDTH + 1) >= STEPPER_MIN_STEP_DELAY)
+#error "STEPPER_MIN_PULSE_WIDTH_IN_CYCLES shall be less than STEPPER_MIN_STEP_DELAY_IN_CYCLES"
+#endif
+
+/**
+ * @struct: struct_stepper_config_type
+ * @brief:  The GPIO(s) of the Step and the Direction inputs of the Stepper Driver. (Ex: A4988 or DRV8825)
+ */
+typedef struct
+{
+    enum_supported_ports_t  enum_step_port;
+    uint8_type              uint8_step_pin;         /*A pulse is generated on each step. It's high while the next step delay is calculated and STEPPER_MIN_PULSE_WIDTH_IN_CYCLES at least.*/
+    enum_supported_ports_t  enum_direction_port;
+    uint8_type              uint8_direction_pin;    /*High for the positive steps.*/
+}struct_stepper_config_type;
+
+/**
+ * @brief:      Function that is used to initialize the Step and the Direction GPIO(s) and Timer 1 in TIMER_MODE_CTC. The motor is stopped.
+ *
+ * @param[in]   pstr_stepper_config:    Address of the Stepper Configurations.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              Or any error returned by @fn: gpio_set_pin_direction or @fn: timer_init on Timer 1. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 1 is used by another module)
+ */
+sint32_type stepper_init(const struct_stepper_config_type* pstr_stepper_config);
+
+/**
+ * @brief:      Function that is used to start a relative move. The motor accelerates to the Speed, cruises and decelerates to stop on the last step.
+ *              In case that the move is too short to reach the Speed, the profile is a triangle and the Deceleration starts at the crossing point.
+ *
+ * @param[in]   sint32_number_of_steps:     The steps to move. The sign is the direction. 0 doesn't move.
+ * @param[in]   uint16_speed:               The Cruise Speed in Steps / Second. @note: This shall not exceed STEPPER_MAX_SPEED.
+ * @param[in]   uint32_acceleration:        The Acceleration in Steps / Second^2. @note: This shall not exceed STEPPER_MAX_ACCELERATION.
+ * @param[in]   uint32_deceleration:        The Deceleration in Steps / Second^2. @note: This shall not exceed STEPPER_MAX_ACCELERATION.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ *              ERROR_MODULE_BUSY: In case that the previous move is not finished.
+ *              ERROR_OUT_OF_BOUNDARY: In case that the Speed exceeds STEPPER_MAX_SPEED or a Step delay doesn't fit 16 Bits. (The Speed or the Acceleration is too low. See @ref: STEPPER_PRESCALAR)
+ */
+sint32_type stepper_move(sint32_type sint32_number_of_steps, uint16_type uint16_speed, uint32_type uint32_acceleration, uint32_type uint32_deceleration);
+
+/**
+ * @brief:      Function that is used to stop the motor at once without Deceleration. The steps may be lost at high Speeds.
+ *
+ * @return      SUCCESS_RETVAL: In case of success, or the motor is already stopped.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ */
+sint32_type stepper_stop(void);
+
+/**
+ * @brief:      Function that is used to check if a move is running.
+ *
+ * @param[out]  puint8_is_running:      Address of a variable in which TRUE or FALSE will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ */
+sint32_type stepper_is_running(uint8_type* puint8_is_running);
+
+/**
+ * @brief:      Function that is used to read the Position. It's updated on each step. So it can be read while the motor is running.
+ *
+ * @param[out]  psint32_position:       Address of a variable in which the Position in Steps will be stored.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ */
+sint32_type stepper_get_position(sint32_type* psint32_position);
+
+/**
+ * @brief:      Function that is used to set the Position. (Ex: 0 after Homing)
+ *
+ * @param[in]   sint32_position:        The new Position in Steps.
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              ERROR_MODULE_NOT_INITAILIZED: In case of not call the @ref: stepper_init before.
+ *              ERROR_MODULE_BUSY: In case that a move is running.
+ */
+sint32_type stepper_set_position(sint32_type sint32_position);
+
+#endif  /*__STEPPER_H__*/
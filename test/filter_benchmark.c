@@ -0,0 +1,150 @@
+/**
+ * @file:       filter_benchmark.c
+ * @author:     Mina Raouf
+ * @brief:      Benchmark of the CPU Cycles per sample of each fixed point filter of filter.c on the AVR.
+ *              Each filter processes a block of BENCHMARK_BLOCK_LENGTH samples between two reads of the Time Base.
+ *              The cost of the two reads is measured on an empty block and subtracted.
+ * @note:       It's a firmware entry point in place of main.c. Build it with filter.c, timestamp.c, timer.c, gpio.c and lcd.c.
+ *              The results are stored in @ref: garr_str_benchmark_results (Read it from simavr or the debugger) and written on the LCD.
+ * @version:    1.0
+ * @date:       2022-08-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "filter.h"
+#include "timestamp.h"
+#include "lcd.h"
+#include "errors.h"
+#include <avr/delay.h>
+
+#define BENCHMARK_BLOCK_LENGTH          64
+#define BENCHMARK_NUMBER_OF_FILTERS     6
+
+/**
+ * @struct: struct_benchmark_result_type
+ * @brief:  The cost of one filter. The Cycles are in 1 / 16 Cycle to keep the fraction of the per sample cost.
+ */
+typedef struct
+{
+    const char*     pchar_filter_name;
+    uint32_type     uint32_cycles_per_block;
+    uint32_type     uint32_cycles_per_sample_x16;
+}struct_benchmark_result_type;
+
+volatile struct_benchmark_result_type   garr_str_benchmark_results[BENCHMARK_NUMBER_OF_FILTERS];
+
+static uint16_type                      garr_uint16_block[BENCHMARK_BLOCK_LENGTH];
+static uint16_type                      garr_uint16_boxcar_history[16];
+static uint32_type                      guint32_overhead_ticks = 0;
+
+/**
+ * @brief:  Function that is used to fill the block with an ADC like signal. So each filter sees the same input.
+ */
+static void fill_block(void)
+{
+    uint8_type uint8_index = 0;
+    for(uint8_index = 0; uint8_index < BENCHMARK_BLOCK_LENGTH; uint8_index++)
+    {
+        garr_uint16_block[uint8_index] = (uint16_type)(512 + ((uint8_index & 0x0F) * 31) - ((uint8_index & 0x10) * 15));
+    }
+}
+
+/**
+ * @brief:  Function that is used to store the cost of a block. The Time Base Ticks are converted to CPU Cycles.
+ */
+static void store_result(uint8_type uint8_filter_index, const char* pchar_filter_name, uint32_type uint32_start_ticks, uint32_type uint32_end_ticks)
+{
+    uint32_type uint32_cycles = ((uint32_end_ticks - uint32_start_ticks) - guint32_overhead_ticks) * TIMESTAMP_PRESCALAR;
+    garr_str_benchmark_results[uint8_filter_index].pchar_filter_name              = pchar_filter_name;
+    garr_str_benchmark_results[uint8_filter_index].uint32_cycles_per_block        = uint32_cycles;
+    garr_str_benchmark_results[uint8_filter_index].uint32_cycles_per_sample_x16   = (uint32_cycles * 16) / BENCHMARK_BLOCK_LENGTH;
+}
+
+int main(void)
+{
+    struct_filter_ema_type          str_filter_ema;
+    struct_filter_boxcar_type       str_filter_boxcar;
+    struct_filter_median_type       str_filter_median;
+    struct_filter_biquad_q15_type   str_filter_biquad;
+    uint32_type                     uint32_start_ticks  = 0;
+    uint32_type                     uint32_end_ticks    = 0;
+    uint8_type                      uint8_filter_index  = 0;
+
+    lcd_init();
+    if(timestamp_init() == SUCCESS_RETVAL)
+    {
+        uint32_start_ticks      = time_now_ticks();
+        uint32_end_ticks        = time_now_ticks();
+        guint32_overhead_ticks  = uint32_end_ticks - uint32_start_ticks;
+
+        /*The first block primes the EMA and the Box-Car. So a second block is measured for the steady state.*/
+        filter_ema_init(&str_filter_ema, 4);
+        fill_block();
+        filter_ema_process(&str_filter_ema, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        fill_block();
+        uint32_start_ticks  = time_now_ticks();
+        filter_ema_process(&str_filter_ema, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        uint32_end_ticks    = time_now_ticks();
+        store_result(0, "ema", uint32_start_ticks, uint32_end_ticks);
+
+        filter_boxcar_init(&str_filter_boxcar, garr_uint16_boxcar_history, 4);
+        fill_block();
+        filter_boxcar_process(&str_filter_boxcar, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        fill_block();
+        uint32_start_ticks  = time_now_ticks();
+        filter_boxcar_process(&str_filter_boxcar, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        uint32_end_ticks    = time_now_ticks();
+        store_result(1, "boxcar 16", uint32_start_ticks, uint32_end_ticks);
+
+        filter_median_init(&str_filter_median, FILTER_MEDIAN_WINDOW_3);
+        fill_block();
+        uint32_start_ticks  = time_now_ticks();
+        filter_median_process(&str_filter_median, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        uint32_end_ticks    = time_now_ticks();
+        store_result(2, "median 3", uint32_start_ticks, uint32_end_ticks);
+
+        filter_median_init(&str_filter_median, FILTER_MEDIAN_WINDOW_5);
+        fill_block();
+        uint32_start_ticks  = time_now_ticks();
+        filter_median_process(&str_filter_median, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        uint32_end_ticks    = time_now_ticks();
+        store_result(3, "median 5", uint32_start_ticks, uint32_end_ticks);
+
+        filter_median_init(&str_filter_median, FILTER_MEDIAN_WINDOW_7);
+        fill_block();
+        uint32_start_ticks  = time_now_ticks();
+        filter_median_process(&str_filter_median, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        uint32_end_ticks    = time_now_ticks();
+        store_result(4, "median 7", uint32_start_ticks, uint32_end_ticks);
+
+        /*Butterworth low pass with fc = fs / 20. (b0, b1, b2, a1, a2) * 2^14*/
+        str_filter_biquad.sint16_b0         = 329;
+        str_filter_biquad.sint16_b1         = 658;
+        str_filter_biquad.sint16_b2         = 329;
+        str_filter_biquad.sint16_a1         = -25576;
+        str_filter_biquad.sint16_a2         = 10508;
+        str_filter_biquad.uint8_post_shift  = 1;
+        filter_biquad_q15_init(&str_filter_biquad);
+        fill_block();
+        uint32_start_ticks  = time_now_ticks();
+        filter_biquad_q15_process(&str_filter_biquad, garr_uint16_block, BENCHMARK_BLOCK_LENGTH);
+        uint32_end_ticks    = time_now_ticks();
+        store_result(5, "biquad", uint32_start_ticks, uint32_end_ticks);
+
+        /*One filter each 2 Seconds: Its index on the first row and the Cycles per sample rounded down on the second row.*/
+        for(uint8_filter_index = 0; uint8_filter_index < BENCHMARK_NUMBER_OF_FILTERS; uint8_filter_index++)
+        {
+            lcd_clear_screen();
+            lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, uint8_filter_index);
+            lcd_goto_row_column(1, 0);
+            lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, (sint32_type)(garr_str_benchmark_results[uint8_filter_index].uint32_cycles_per_sample_x16 >> 4));
+            _delay_ms(2000);
+        }
+    }
+
+    while(1)
+    {
+    }
+}
@@ -0,0 +1,353 @@
+/**
+ * @file:       filter_host_test.c
+ * @author:     Mina Raouf
+ * @brief:      Host check of the fixed point filters of filter.c against a double precision reference.
+ *              Each filter runs on a step, a sine and a pseudo random signal. The worst error in LSBs is printed and compared to the allowed limit.
+ * @note:       It's built and run on the PC. (Not on the AVR)
+ *              gcc -I.. -o filter_host_test filter_host_test.c ../filter.c -lm && ./filter_host_test
+ *              The process exit code is 0 in case that all the checks pass.
+ *              sint32_type is 64 Bits on a 64 Bits PC. The Biquad accumulator is clamped at the 32 Bits limits explicitly. So the results are the same as on the AVR.
+ * @version:    1.0
+ * @date:       2022-08-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "filter.h"
+#include "errors.h"
+
+#define TEST_NUMBER_OF_SAMPLES      2048
+#define TEST_BLOCK_LENGTH           64
+#define TEST_PI                     3.14159265358979323846
+
+#define TEST_SIGNAL_STEP            0
+#define TEST_SIGNAL_SINE            1
+#define TEST_SIGNAL_RANDOM          2
+#define TEST_NUMBER_OF_SIGNALS      3
+
+static const char* garr_signal_names[TEST_NUMBER_OF_SIGNALS] = {"step", "sine", "random"};
+static uint32_type guint32_random_state = 12345;
+static int gint_number_of_failures = 0;
+
+/**
+ * @brief:  Linear congruential generator. So the random signal is the same on each run.
+ */
+static uint16_type next_random(void)
+{
+    guint32_random_state = (guint32_random_state * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+    return (uint16_type)(guint32_random_state >> 16);
+}
+
+/**
+ * @brief:  Function that is used to fill a 10 Bits ADC like signal. (0 to 1023)
+ */
+static void generate_signal(int int_signal, uint16_type* puint16_samples)
+{
+    int int_index = 0;
+    guint32_random_state = 12345;
+    for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+    {
+        switch(int_signal)
+        {
+            case TEST_SIGNAL_STEP:
+            {
+                puint16_samples[int_index] = (int_index < (TEST_NUMBER_OF_SAMPLES / 2)) ? 100 : 900;
+                break;
+            }
+            case TEST_SIGNAL_SINE:
+            {
+                puint16_samples[int_index] = (uint16_type)lround(512.0 + 500.0 * sin((2.0 * TEST_PI * int_index) / 100.0));
+                break;
+            }
+            default:
+            {
+                puint16_samples[int_index] = (uint16_type)(next_random() & 0x3FF);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief:  Function that is used to print and check the worst error of one filter on one signal.
+ */
+static void report(const char* pchar_filter_name, int int_signal, double double_max_error, double double_allowed_error)
+{
+    const char* pchar_result = "PASS";
+    if(double_max_error > double_allowed_error)
+    {
+        pchar_result = "FAIL";
+        gint_number_of_failures++;
+    }
+    printf("%-22s %-7s max error %8.3f LSB (allowed %5.2f) %s\n", pchar_filter_name, garr_signal_names[int_signal], double_max_error, double_allowed_error, pchar_result);
+}
+
+static void test_ema(uint8_type uint8_shift)
+{
+    uint16_type             arr_uint16_input[TEST_NUMBER_OF_SAMPLES];
+    uint16_type             arr_uint16_output[TEST_NUMBER_OF_SAMPLES];
+    struct_filter_ema_type  str_filter_ema;
+    char                    arr_char_name[32];
+    double                  double_reference    = 0.0;
+    double                  double_max_error    = 0.0;
+    int                     int_signal          = 0;
+    int                     int_index           = 0;
+
+    sprintf(arr_char_name, "ema shift %u", uint8_shift);
+    for(int_signal = 0; int_signal < TEST_NUMBER_OF_SIGNALS; int_signal++)
+    {
+        generate_signal(int_signal, arr_uint16_input);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            arr_uint16_output[int_index] = arr_uint16_input[int_index];
+        }
+        filter_ema_init(&str_filter_ema, uint8_shift);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index += TEST_BLOCK_LENGTH)
+        {
+            filter_ema_process(&str_filter_ema, &arr_uint16_output[int_index], TEST_BLOCK_LENGTH);
+        }
+
+        double_max_error = 0.0;
+        double_reference = arr_uint16_input[0];
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            double_reference += (arr_uint16_input[int_index] - double_reference) / (double)(1UL << uint8_shift);
+            double_max_error  = fmax(double_max_error, fabs(arr_uint16_output[int_index] - double_reference));
+        }
+        /*The output is truncated to an integer. So it's within 1 LSB of the reference.*/
+        report(arr_char_name, int_signal, double_max_error, 1.0);
+    }
+}
+
+static void test_boxcar(uint8_type uint8_shift)
+{
+    uint16_type                 arr_uint16_input[TEST_NUMBER_OF_SAMPLES];
+    uint16_type                 arr_uint16_output[TEST_NUMBER_OF_SAMPLES];
+    uint16_type                 arr_uint16_history[1 << FILTER_BOXCAR_MAX_SHIFT];
+    struct_filter_boxcar_type   str_filter_boxcar;
+    char                        arr_char_name[32];
+    double                      double_reference    = 0.0;
+    double                      double_max_error    = 0.0;
+    int                         int_signal          = 0;
+    int                         int_index           = 0;
+    int                         int_window_index    = 0;
+    int                         int_sample_index    = 0;
+
+    sprintf(arr_char_name, "boxcar shift %u", uint8_shift);
+    for(int_signal = 0; int_signal < TEST_NUMBER_OF_SIGNALS; int_signal++)
+    {
+        generate_signal(int_signal, arr_uint16_input);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            arr_uint16_output[int_index] = arr_uint16_input[int_index];
+        }
+        filter_boxcar_init(&str_filter_boxcar, arr_uint16_history, uint8_shift);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index += TEST_BLOCK_LENGTH)
+        {
+            filter_boxcar_process(&str_filter_boxcar, &arr_uint16_output[int_index], TEST_BLOCK_LENGTH);
+        }
+
+        double_max_error = 0.0;
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            /*The history before the first sample is filled with the first sample.*/
+            double_reference = 0.0;
+            for(int_window_index = 0; int_window_index < (1 << uint8_shift); int_window_index++)
+            {
+                int_sample_index  = (int_index >= int_window_index) ? (int_index - int_window_index) : 0;
+                double_reference += arr_uint16_input[int_sample_index];
+            }
+            double_reference /= (double)(1UL << uint8_shift);
+            double_max_error  = fmax(double_max_error, fabs(arr_uint16_output[int_index] - double_reference));
+        }
+        report(arr_char_name, int_signal, double_max_error, 1.0);
+    }
+}
+
+static int compare_uint16(const void* pvoid_a, const void* pvoid_b)
+{
+    return (int)(*(const uint16_type*)pvoid_a) - (int)(*(const uint16_type*)pvoid_b);
+}
+
+static void test_median(enum_filter_median_window_type enum_filter_median_window)
+{
+    uint16_type                 arr_uint16_input[TEST_NUMBER_OF_SAMPLES];
+    uint16_type                 arr_uint16_output[TEST_NUMBER_OF_SAMPLES];
+    uint16_type                 arr_uint16_window[FILTER_MEDIAN_MAX_WINDOW];
+    struct_filter_median_type   str_filter_median;
+    char                        arr_char_name[32];
+    double                      double_max_error    = 0.0;
+    int                         int_window          = (int)enum_filter_median_window;
+    int                         int_signal          = 0;
+    int                         int_index           = 0;
+    int                         int_window_index    = 0;
+
+    sprintf(arr_char_name, "median of %d", int_window);
+    for(int_signal = 0; int_signal < TEST_NUMBER_OF_SIGNALS; int_signal++)
+    {
+        generate_signal(int_signal, arr_uint16_input);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            arr_uint16_output[int_index] = arr_uint16_input[int_index];
+        }
+        filter_median_init(&str_filter_median, enum_filter_median_window);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index += TEST_BLOCK_LENGTH)
+        {
+            filter_median_process(&str_filter_median, &arr_uint16_output[int_index], TEST_BLOCK_LENGTH);
+        }
+
+        double_max_error = 0.0;
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            /*The window before the first samples is filled with 0.*/
+            for(int_window_index = 0; int_window_index < int_window; int_window_index++)
+            {
+                arr_uint16_window[int_window_index] = (int_index >= int_window_index) ? arr_uint16_input[int_index - int_window_index] : 0;
+            }
+            qsort(arr_uint16_window, int_window, sizeof(uint16_type), compare_uint16);
+            double_max_error = fmax(double_max_error, fabs((double)arr_uint16_output[int_index] - arr_uint16_window[int_window / 2]));
+        }
+        /*The sorting network shall give the exact median.*/
+        report(arr_char_name, int_signal, double_max_error, 0.0);
+    }
+}
+
+/**
+ * @brief:  Function that is used to run the Biquad on a signal and compare it to the double precision Direct Form I with the ideal coefficients.
+ */
+static double run_biquad(const double* pdouble_coefficients, uint8_type uint8_post_shift, const sint16_type* psint16_input, int int_length, double double_offset, sint16_type* psint16_output)
+{
+    struct_filter_biquad_q15_type   str_filter_biquad;
+    uint16_type                     arr_uint16_block[TEST_NUMBER_OF_SAMPLES];
+    double                          double_scale        = (double)(1UL << (FILTER_BIQUAD_Q15_FRACTION_BITS - uint8_post_shift));
+    double                          arr_double_x[3]     = {0.0, 0.0, 0.0};
+    double                          arr_double_y[3]     = {0.0, 0.0, 0.0};
+    double                          double_max_error    = 0.0;
+    int                             int_index           = 0;
+
+    str_filter_biquad.sint16_b0         = (sint16_type)lround(pdouble_coefficients[0] * double_scale);
+    str_filter_biquad.sint16_b1         = (sint16_type)lround(pdouble_coefficients[1] * double_scale);
+    str_filter_biquad.sint16_b2         = (sint16_type)lround(pdouble_coefficients[2] * double_scale);
+    str_filter_biquad.sint16_a1         = (sint16_type)lround(pdouble_coefficients[3] * double_scale);
+    str_filter_biquad.sint16_a2         = (sint16_type)lround(pdouble_coefficients[4] * double_scale);
+    str_filter_biquad.uint8_post_shift  = uint8_post_shift;
+    filter_biquad_q15_init(&str_filter_biquad);
+
+    for(int_index = 0; int_index < int_length; int_index++)
+    {
+        arr_uint16_block[int_index] = (uint16_type)psint16_input[int_index];
+    }
+    for(int_index = 0; int_index < int_length; int_index += TEST_BLOCK_LENGTH)
+    {
+        filter_biquad_q15_process(&str_filter_biquad, &arr_uint16_block[int_index], TEST_BLOCK_LENGTH);
+    }
+
+    for(int_index = 0; int_index < int_length; int_index++)
+    {
+        arr_double_x[2] = arr_double_x[1];
+        arr_double_x[1] = arr_double_x[0];
+        arr_double_x[0] = psint16_input[int_index];
+        arr_double_y[2] = arr_double_y[1];
+        arr_double_y[1] = arr_double_y[0];
+        arr_double_y[0] =   (pdouble_coefficients[0] * arr_double_x[0]) + (pdouble_coefficients[1] * arr_double_x[1]) + (pdouble_coefficients[2] * arr_double_x[2])
+                          - (pdouble_coefficients[3] * arr_double_y[1]) - (pdouble_coefficients[4] * arr_double_y[2]);
+        psint16_output[int_index] = (sint16_type)arr_uint16_block[int_index];
+        /*The start up transient is skipped. The coefficients quantization shows up as a small gain error on the steady state.*/
+        if(int_index >= (int_length / 4))
+        {
+            double_max_error = fmax(double_max_error, fabs(psint16_output[int_index] - arr_double_y[0] - double_offset));
+        }
+    }
+    return double_max_error;
+}
+
+static void test_biquad(void)
+{
+    /*b0, b1, b2, a1, a2. Butterworth 2nd order with fc = fs / 20 designed by the bilinear transform.*/
+    static const double arr_double_low_pass[5]  = { 0.0200833656,  0.0401667311,  0.0200833656, -1.5610180758,  0.6413515381};
+    static const double arr_double_high_pass[5] = { 0.8005924034, -1.6011848068,  0.8005924034, -1.5610180758,  0.6413515381};
+    sint16_type         arr_sint16_input[TEST_NUMBER_OF_SAMPLES];
+    sint16_type         arr_sint16_output[TEST_NUMBER_OF_SAMPLES];
+    uint16_type         arr_uint16_signal[TEST_NUMBER_OF_SAMPLES];
+    double              double_max_error    = 0.0;
+    int                 int_signal          = 0;
+    int                 int_index           = 0;
+    int                 int_is_wrapped      = 0;
+    sint16_type         sint16_min_output   = 0;
+
+    for(int_signal = 0; int_signal < TEST_NUMBER_OF_SIGNALS; int_signal++)
+    {
+        generate_signal(int_signal, arr_uint16_signal);
+        for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+        {
+            /*The ADC codes are scaled by 16 to use the Q15 range.*/
+            arr_sint16_input[int_index] = (sint16_type)(arr_uint16_signal[int_index] << 4);
+        }
+        double_max_error = run_biquad(arr_double_low_pass, 1, arr_sint16_input, TEST_NUMBER_OF_SAMPLES, 0.0, arr_sint16_output);
+        report("biquad low pass", int_signal, double_max_error / 16.0, 1.0);
+
+        double_max_error = run_biquad(arr_double_high_pass, 1, arr_sint16_input, TEST_NUMBER_OF_SAMPLES, 0.0, arr_sint16_output);
+        report("biquad high pass", int_signal, double_max_error / 16.0, 1.0);
+    }
+
+    /*The high pass output of the sine swings around 0. So the negative half shall be kept.*/
+    generate_signal(TEST_SIGNAL_SINE, arr_uint16_signal);
+    for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+    {
+        arr_sint16_input[int_index] = (sint16_type)(arr_uint16_signal[int_index] << 4);
+    }
+    run_biquad(arr_double_high_pass, 1, arr_sint16_input, TEST_NUMBER_OF_SAMPLES, 0.0, arr_sint16_output);
+    for(int_index = (TEST_NUMBER_OF_SAMPLES / 4); int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+    {
+        if(arr_sint16_output[int_index] < sint16_min_output)
+        {
+            sint16_min_output = arr_sint16_output[int_index];
+        }
+    }
+    printf("%-22s %-7s min output %6d %s\n", "biquad high pass", "sign", sint16_min_output, (sint16_min_output < -100) ? "PASS" : "FAIL");
+    gint_number_of_failures += (sint16_min_output < -100) ? 0 : 1;
+
+    /*Full scale square wave on a resonant low pass. The accumulator overflows 32 Bits. The output shall clip at the limits and never flip its sign.*/
+    for(int_index = 0; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+    {
+        arr_sint16_input[int_index] = ((int_index / 50) & 1) ? -32768 : 32767;
+    }
+    {
+        static const double arr_double_resonant[5] = { 0.9, 0.9, 0.9, -1.9, 0.95};
+        run_biquad(arr_double_resonant, 1, arr_sint16_input, TEST_NUMBER_OF_SAMPLES, 0.0, arr_sint16_output);
+    }
+    for(int_index = 1; int_index < TEST_NUMBER_OF_SAMPLES; int_index++)
+    {
+        /*A wrap around jumps from one limit to the other in one sample.*/
+        if(((arr_sint16_output[int_index - 1] > 30000) && (arr_sint16_output[int_index] < -30000)) || ((arr_sint16_output[int_index - 1] < -30000) && (arr_sint16_output[int_index] > 30000)))
+        {
+            int_is_wrapped = 1;
+        }
+    }
+    printf("%-22s %-7s %s\n", "biquad saturation", "square", (int_is_wrapped == 0) ? "PASS" : "FAIL");
+    gint_number_of_failures += int_is_wrapped;
+}
+
+int main(void)
+{
+    uint8_type uint8_shift = 0;
+    for(uint8_shift = 1; uint8_shift <= 6; uint8_shift++)
+    {
+        test_ema(uint8_shift);
+    }
+    for(uint8_shift = 1; uint8_shift <= FILTER_BOXCAR_MAX_SHIFT; uint8_shift++)
+    {
+        test_boxcar(uint8_shift);
+    }
+    test_median(FILTER_MEDIAN_WINDOW_3);
+    test_median(FILTER_MEDIAN_WINDOW_5);
+    test_median(FILTER_MEDIAN_WINDOW_7);
+    test_biquad();
+
+    printf("%d failure(s)\n", gint_number_of_failures);
+    return (gint_number_of_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,19 @@
+/**
+ * @file:       interrupt.h
+ * @author:     Mina Raouf
+ * @brief:      Host replacement of <avr/interrupt.h> for the host checks. The ISR(s) are compiled as normal functions.
+ * @version:    1.0
+ * @date:       2022-08-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef __HOST_AVR_INTERRUPT_H__
+#define __HOST_AVR_INTERRUPT_H__
+
+#define ISR(VECTOR)     void VECTOR(void); void VECTOR(void)
+#define sei()           do{}while(0)
+#define cli()           do{}while(0)
+
+#endif  /*__HOST_AVR_INTERRUPT_H__*/
@@ -0,0 +1,170 @@
+/**
+ * @file:       timer_host_test.c
+ * @author:     Mina Raouf
+ * @brief:      Host check of the integer delay math of timer.c against a double precision reference for each entry of the prescalar table.
+ *              For each prescalar and delay it checks:
+ *              -   The Ticks and the fraction of a Tick of @fn: calculate_delay_ticks.
+ *              -   The Achieved Delay of @fn: timer_get_achieved_delay.
+ *              -   The split on the 8 Bits and 16 Bits Timer Interrupts in TIMER_MODE_OVF and TIMER_MODE_CTC.
+ *              -   The longest delay of the prescalar and ERROR_OUT_OF_BOUNDARY just above it.
+ * @note:       It's built and run on the PC. (Not on the AVR) F_CPU can be changed on the command line.
+ *              gcc -DATMEGA_32A -DF_CPU=16000000UL -Ihost -I.. -o timer_host_test timer_host_test.c && ./timer_host_test
+ *              timer.c is included in this file. So its static functions are reached, and its 32 Bits types are the AVR ones (Not the 64 Bits long of the PC).
+ *              No function that accesses the registers is called.
+ *              The process exit code is 0 in case that all the checks pass.
+ * @version:    1.0
+ * @date:       2022-08-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+/*The AVR sizes of the types. So each 32 Bits product wraps around like on the AVR.*/
+#define __TYPES_H__
+#define NULL_PTR            (void*) 0
+#define FALSE               0
+#define TRUE                1
+typedef char                sint8_type;
+typedef unsigned char       uint8_type;
+typedef short               sint16_type;
+typedef unsigned short      uint16_type;
+typedef int                 sint32_type;
+typedef unsigned int        uint32_type;
+typedef float               fint32_type;
+typedef double              fint64_type;
+
+#include "timer.c"
+
+#define TEST_NUMBER_OF_DELAYS       10
+
+static const uint32_type garr_uint32_delays_in_ms[TEST_NUMBER_OF_DELAYS] = {1, 2, 7, 10, 33, 100, 999, 1000, 12345, 65535};
+static int gint_number_of_failures = 0;
+
+/*The Timer 0 and Timer 2 functions are not called. They are linked only.*/
+sint32_type gpio_set_pin_direction(enum_supported_ports_t enum_port, uint8_type uint8_pin, enum_supported_directions_t enum_direction)
+{
+    return SUCCESS_RETVAL;
+}
+
+sint32_type gpio_mainpulate_pin(enum_supported_operations_t enum_operation, enum_supported_ports_t enum_port, uint8_type uint8_pin)
+{
+    return SUCCESS_RETVAL;
+}
+
+static void check(int int_is_passed)
+{
+    if(int_is_passed == 0)
+    {
+        gint_number_of_failures++;
+    }
+}
+
+/**
+ * @brief:  Function that is used to check one delay on one prescalar and print its row of the table.
+ *          The reference is ms * F_CPU / (1000 * prescalar) Ticks in double. The Ticks are truncated and the fraction is in (1 / prescalar) Ticks.
+ */
+static void test_delay(const struct_timer_prescalar_info_type* pstr_prescalar_info, uint32_type uint32_delay_in_ms)
+{
+    uint32_type                     uint32_prescalar        = (uint32_type)pstr_prescalar_info->enum_timer_prescalar_value;
+    uint32_type                     uint32_ticks            = 0;
+    uint16_type                     uint16_fraction         = 0;
+    uint32_type                     uint32_achieved_in_us   = 0;
+    struct_timer_delay_split_type   str_delay_split;
+    double                          double_reference_ticks  = ((double)uint32_delay_in_ms * (double)F_CPU) / (1000.0 * (double)uint32_prescalar);
+    double                          double_ticks            = 0.0;
+    double                          double_reference_in_us  = 0.0;
+    double                          double_error_in_us      = 0.0;
+    int                             int_is_passed           = 1;
+
+    if(calculate_delay_ticks(pstr_prescalar_info->enum_timer_prescalar_value, uint32_delay_in_ms, &uint32_ticks, &uint16_fraction) != SUCCESS_RETVAL)
+    {
+        printf("%9u %10u %12s FAIL (unexpected error)\n", (unsigned int)uint32_prescalar, (unsigned int)uint32_delay_in_ms, "-");
+        gint_number_of_failures++;
+        return;
+    }
+
+    /*A delay shorter than one Tick is rounded up to one Tick.*/
+    double_ticks = (double)uint32_ticks + ((double)uint16_fraction / (double)uint32_prescalar);
+    if(double_reference_ticks >= 1.0)
+    {
+        int_is_passed &= (fabs(double_ticks - double_reference_ticks) < 1e-6);
+        int_is_passed &= (uint16_fraction < uint32_prescalar);
+    }
+    else
+    {
+        int_is_passed &= ((uint32_ticks == 1) && (uint16_fraction == 0));
+    }
+
+    /*The Achieved Delay is the Ticks in Micro Seconds truncated.*/
+    global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_index_in_db             = TIMER_INDEX_1;
+    global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_prescalar_value_in_db   = pstr_prescalar_info->enum_timer_prescalar_value;
+    global_arr_str_timer_database[TIMER_INDEX_1].uint32_achieved_delay_ticks_in_db  = uint32_ticks;
+    int_is_passed &= (timer_get_achieved_delay(TIMER_INDEX_1, &uint32_achieved_in_us) == SUCCESS_RETVAL);
+    double_reference_in_us  = ((double)uint32_ticks * (double)uint32_prescalar * 1000.0) / (double)(F_CPU / 1000UL);
+    int_is_passed &= (uint32_achieved_in_us == (uint32_type)floor(double_reference_in_us));
+    double_error_in_us      = (double)uint32_achieved_in_us - ((double)uint32_delay_in_ms * 1000.0);
+
+    /*TIMER_MODE_OVF keeps the Ticks. TIMER_MODE_CTC rounds each segment. So its error is half a Tick per interrupt at most.*/
+    split_delay_ticks(TIMER_MODE_OVF, uint32_ticks, COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER, &str_delay_split);
+    int_is_passed &= (str_delay_split.uint32_achieved_ticks == uint32_ticks);
+    int_is_passed &= ((str_delay_split.uint32_number_of_interrupts * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER) - str_delay_split.uint16_register_value == uint32_ticks);
+    split_delay_ticks(TIMER_MODE_OVF, uint32_ticks, COUNTS_TILL_OVERFLOW_IN_16_BIT_TIMER, &str_delay_split);
+    int_is_passed &= ((str_delay_split.uint32_number_of_interrupts * COUNTS_TILL_OVERFLOW_IN_16_BIT_TIMER) - str_delay_split.uint16_register_value == uint32_ticks);
+    split_delay_ticks(TIMER_MODE_CTC, uint32_ticks, COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER, &str_delay_split);
+    int_is_passed &= (fabs((double)str_delay_split.uint32_achieved_ticks - (double)uint32_ticks) <= ((double)str_delay_split.uint32_number_of_interrupts / 2.0));
+    int_is_passed &= (str_delay_split.uint16_register_value < COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER);
+
+    printf("%9u %10u %12u %5u %14.4f %12u %12.1f %s\n", (unsigned int)uint32_prescalar, (unsigned int)uint32_delay_in_ms, (unsigned int)uint32_ticks, (unsigned int)uint16_fraction,
+            double_reference_ticks, (unsigned int)uint32_achieved_in_us, double_error_in_us, (int_is_passed != 0) ? "PASS" : "FAIL");
+    check(int_is_passed);
+}
+
+/**
+ * @brief:  Function that is used to check the longest delay of a prescalar. Its Ticks shall not wrap around 32 Bits.
+ *          One Milli Second more shall be rejected. Unless the longest delay is the 32 Bits limit itself. (Less than one Tick per Milli Second)
+ */
+static void test_max_delay(const struct_timer_prescalar_info_type* pstr_prescalar_info)
+{
+    uint32_type uint32_prescalar    = (uint32_type)pstr_prescalar_info->enum_timer_prescalar_value;
+    uint32_type uint32_max_delay    = pstr_prescalar_info->uint32_max_delay_in_ms;
+    uint32_type uint32_ticks        = 0;
+    uint16_type uint16_fraction     = 0;
+    double      double_reference    = ((double)uint32_max_delay * (double)(F_CPU / 1000UL)) / (double)uint32_prescalar;
+    int         int_is_passed       = 1;
+
+    int_is_passed &= (calculate_delay_ticks(pstr_prescalar_info->enum_timer_prescalar_value, uint32_max_delay, &uint32_ticks, &uint16_fraction) == SUCCESS_RETVAL);
+    int_is_passed &= (fabs(((double)uint32_ticks + ((double)uint16_fraction / (double)uint32_prescalar)) - double_reference) < 1e-6);
+    if(uint32_max_delay < 0xFFFFFFFFUL)
+    {
+        int_is_passed &= (calculate_delay_ticks(pstr_prescalar_info->enum_timer_prescalar_value, uint32_max_delay + 1, &uint32_ticks, &uint16_fraction) == ERROR_OUT_OF_BOUNDARY);
+    }
+    printf("%9u max delay %10u ms %s\n", (unsigned int)uint32_prescalar, (unsigned int)uint32_max_delay, (int_is_passed != 0) ? "PASS" : "FAIL");
+    check(int_is_passed);
+}
+
+int main(void)
+{
+    uint8_type uint8_prescalar_index    = 0;
+    uint8_type uint8_delay_index        = 0;
+
+    init_timers_database();
+    printf("F_CPU = %lu Hz\n", (unsigned long)F_CPU);
+    printf("%9s %10s %12s %5s %14s %12s %12s\n", "prescalar", "delay ms", "ticks", "frac", "reference", "achieved us", "error us");
+    for(uint8_prescalar_index = 0; uint8_prescalar_index < FIND_ARR_LENGTH(global_arr_str_prescalar_info_table); uint8_prescalar_index++)
+    {
+        for(uint8_delay_index = 0; uint8_delay_index < TEST_NUMBER_OF_DELAYS; uint8_delay_index++)
+        {
+            test_delay(&global_arr_str_prescalar_info_table[uint8_prescalar_index], garr_uint32_delays_in_ms[uint8_delay_index]);
+        }
+    }
+    for(uint8_prescalar_index = 0; uint8_prescalar_index < FIND_ARR_LENGTH(global_arr_str_prescalar_info_table); uint8_prescalar_index++)
+    {
+        test_max_delay(&global_arr_str_prescalar_info_table[uint8_prescalar_index]);
+    }
+
+    printf("%d failure(s)\n", gint_number_of_failures);
+    return (gint_number_of_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file:       timer_isr_benchmark.c
+ * @author:     Mina Raouf
+ * @brief:      Benchmark of the CPU Cycles of one Timer 0 Overflow Interrupt on the AVR.
+ *              The same busy loop is timed with the clock of Timer 0 stopped and running. The difference is the time taken by the interrupts.
+ *              Two paths are measured:
+ *              -   The countdown path: A long one shot @fn: timer_delay is running. So each interrupt decrements the countdown only.
+ *              -   The callback path:  Each interrupt calls the callback. (The default of @fn: timer_init without a delay)
+ * @note:       It's a firmware entry point in place of main.c. Build it with timer.c, timestamp.c, gpio.c and lcd.c.
+ *              The "before" numbers are taken by building it against the timer.c that precedes the 16 Bits countdown of the ISRs,
+ *              with BENCHMARK_LEGACY_TIMER_DELAY defined. (Its @fn: timer_delay has no delay mode)
+ *              The results are stored in @ref: garr_str_benchmark_results (Read it from simavr or the debugger) and written on the LCD.
+ * @version:    1.0
+ * @date:       2022-08-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "timer.h"
+#include "timestamp.h"
+#include "lcd.h"
+#include "errors.h"
+#include <avr/delay.h>
+
+#define BENCHMARK_BUSY_LOOP_LENGTH          20000
+#define BENCHMARK_NUMBER_OF_PATHS           2
+#define BENCHMARK_TIMER_0_PRESCALAR         8
+#define BENCHMARK_CYCLES_PER_INTERRUPT      (256UL * BENCHMARK_TIMER_0_PRESCALAR)
+/*Longer than the busy loop. So the callback is not called on the countdown path.*/
+#define BENCHMARK_COUNTDOWN_DELAY_IN_MS     1000
+
+#ifdef BENCHMARK_LEGACY_TIMER_DELAY
+#define BENCHMARK_START_COUNTDOWN()         timer_delay(TIMER_INDEX_0, BENCHMARK_COUNTDOWN_DELAY_IN_MS)
+#else
+#define BENCHMARK_START_COUNTDOWN()         timer_delay(TIMER_INDEX_0, BENCHMARK_COUNTDOWN_DELAY_IN_MS, TIMER_DELAY_ONE_SHOT)
+#endif
+
+/**
+ * @struct: struct_benchmark_result_type
+ * @brief:  The cost of one interrupt path. The Cycles are in 1 / 16 Cycle to keep the fraction of the per interrupt cost.
+ */
+typedef struct
+{
+    const char*     pchar_path_name;
+    uint32_type     uint32_number_of_interrupts;
+    uint32_type     uint32_cycles_per_interrupt_x16;
+}struct_benchmark_result_type;
+
+volatile struct_benchmark_result_type   garr_str_benchmark_results[BENCHMARK_NUMBER_OF_PATHS];
+
+static volatile uint16_type             guint16_busy_counter        = 0;
+static volatile uint16_type             guint16_number_of_callbacks = 0;
+
+static void benchmark_callback(enum_timer_index_type enum_timer_index)
+{
+    guint16_number_of_callbacks++;
+}
+
+static const tstr_timer_config gstr_timer_0_config =    {
+                                                            .enum_timer_index               = TIMER_INDEX_0,
+                                                            .enum_timer_interrupt_usage     = TIMER_USAGE_INTERRUPT,
+                                                            .enum_timer_mode                = TIMER_MODE_OVF,
+                                                            .enum_timer_prescalar_value     = TIMER_8_PRESCALAR,
+                                                            .pointer_func_timer_callback    = benchmark_callback,
+                                                        };
+
+/**
+ * @brief:  Function that is used to run the same busy loop in each window and return its time in Time Base Ticks.
+ */
+static uint32_type time_busy_loop(void)
+{
+    uint32_type uint32_start_ticks = time_now_ticks();
+    for(guint16_busy_counter = 0; guint16_busy_counter < BENCHMARK_BUSY_LOOP_LENGTH; guint16_busy_counter++)
+    {
+    }
+    return (time_now_ticks() - uint32_start_ticks);
+}
+
+/**
+ * @brief:  Function that is used to store the cost of one interrupt. The Time Base Ticks are converted to CPU Cycles.
+ */
+static void store_result(uint8_type uint8_path_index, const char* pchar_path_name, uint32_type uint32_idle_ticks, uint32_type uint32_busy_ticks, uint32_type uint32_number_of_interrupts)
+{
+    uint32_type uint32_cycles = (uint32_busy_ticks - uint32_idle_ticks) * TIMESTAMP_PRESCALAR;
+    garr_str_benchmark_results[uint8_path_index].pchar_path_name                  = pchar_path_name;
+    garr_str_benchmark_results[uint8_path_index].uint32_number_of_interrupts      = uint32_number_of_interrupts;
+    if(uint32_number_of_interrupts != 0)
+    {
+        garr_str_benchmark_results[uint8_path_index].uint32_cycles_per_interrupt_x16  = (uint32_cycles * 16) / uint32_number_of_interrupts;
+    }
+}
+
+int main(void)
+{
+    uint32_type     uint32_idle_ticks   = 0;
+    uint32_type     uint32_busy_ticks   = 0;
+    uint8_type      uint8_path_index    = 0;
+
+    lcd_init();
+    if((timestamp_init() == SUCCESS_RETVAL) && (timer_init(&gstr_timer_0_config) == SUCCESS_RETVAL))
+    {
+        /*The Global Interrupts are enabled by @fn: timer_init. The Timer 1 Overflow of the Time Base is in all the windows. So it's cancelled by the subtraction.*/
+        uint32_idle_ticks = time_busy_loop();
+
+        /*The countdown path: The interrupts in the window are found from its length. Its error is one interrupt at most.*/
+        if(BENCHMARK_START_COUNTDOWN() == SUCCESS_RETVAL)
+        {
+            uint32_busy_ticks = time_busy_loop();
+            timer_disable(TIMER_INDEX_0);
+            store_result(0, "countdown", uint32_idle_ticks, uint32_busy_ticks, (uint32_busy_ticks * TIMESTAMP_PRESCALAR) / BENCHMARK_CYCLES_PER_INTERRUPT);
+        }
+
+        /*The callback path: The callback counts the interrupts. Its own cost is a part of the result.*/
+        if(timer_deinit(TIMER_INDEX_0) == SUCCESS_RETVAL)
+        {
+            if(timer_init(&gstr_timer_0_config) == SUCCESS_RETVAL)
+            {
+                guint16_number_of_callbacks = 0;
+                timer_enable(TIMER_INDEX_0);
+                uint32_busy_ticks = time_busy_loop();
+                timer_disable(TIMER_INDEX_0);
+                store_result(1, "callback", uint32_idle_ticks, uint32_busy_ticks, guint16_number_of_callbacks);
+            }
+        }
+
+        /*One path each 2 Seconds: Its index on the first row and the Cycles per interrupt rounded down on the second row.*/
+        for(uint8_path_index = 0; uint8_path_index < BENCHMARK_NUMBER_OF_PATHS; uint8_path_index++)
+        {
+            lcd_clear_screen();
+            lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, uint8_path_index);
+            lcd_goto_row_column(1, 0);
+            lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, (sint32_type)(garr_str_benchmark_results[uint8_path_index].uint32_cycles_per_interrupt_x16 >> 4));
+            _delay_ms(2000);
+        }
+    }
+
+    while(1)
+    {
+    }
+}
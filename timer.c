@@ -22,9 +22,19 @@
 #endif
 
 
-#define MUL_FACTOR                              1000000         /*Factor to convert the F_CPU from Million to a single digit*/
+/*The CPU Frequency in KHz. It's the number of CPU cycles in one Milli Second. So all the delay calculations stay in integers.*/
+#define F_KHZ                                   (F_CPU / 1000UL)
+#if ((F_CPU % 1000UL) != 0)
+#error "F_CPU shall be a multiple of 1 KHz for the timer delay calculations."
+#endif
+
+/*Compile time parameters of each prescalar. Ticks per Milli Second = F_KHZ / 2^SHIFT = TICKS_PER_MS + REMAINDER / 2^SHIFT*/
+#define TIMER_TICKS_PER_MS(SHIFT)               ((uint16_type)(F_KHZ >> (SHIFT)))
+#define TIMER_TICKS_PER_MS_REMAINDER(SHIFT)     ((uint16_type)(F_KHZ & ((1UL << (SHIFT)) - 1)))
+#define TIMER_MAX_DELAY_IN_MS(SHIFT)            (0xFFFFFFFFUL / ((F_KHZ >> (SHIFT)) + 1))
+
 #define CONVERT_FROM_MILLI_TO_MICRO             1000
-#define CONVERT_FROM_NANO_TO_MILLI              1000
+#define MAX_DELAY_IN_US                         0xFFFFFFFFUL
 #define COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER     256
 #define OVERFLOW_VALUE_IN_8_BIT_TIMER           255
 #define COUNTS_TILL_OVERFLOW_IN_16_BIT_TIMER    65536
@@ -33,6 +43,13 @@
 #define FIND_ARR_LENGTH(ARR_NAME)               ((sizeof(ARR_NAME)) / sizeof(ARR_NAME[0]))
 #define MIN_DELAY_VALUE                         0
 #define MIN_DUTY_CYCLE_VALUE                    0
+#define MAX_NUMBER_OF_INTERRUPTS                0xFFFF  /*The ISR(s) count the interrupts of one delay in 16 Bits.*/
+#define MAX_NUMBER_OF_DROPPED_EVENTS            0xFFFF
+#define TIMER_EVENT_QUEUE_MASK                  (TIMER_EVENT_QUEUE_SIZE - 1)
+
+#if (((TIMER_EVENT_QUEUE_SIZE & TIMER_EVENT_QUEUE_MASK) != 0) || (TIMER_EVENT_QUEUE_SIZE < 2) || (TIMER_EVENT_QUEUE_SIZE > 128))
+#error "TIMER_EVENT_QUEUE_SIZE shall be a power of 2 from 2 to 128."
+#endif
 #define MAX_DUTY_CYCLE_VALUE                    100
 
 #define I_BIT                                   7
@@ -40,10 +57,10 @@
 #define TOIE0_BIT                               0
 #define OCIE0_BIT                               1
 
-#define TOIE1_BIT                               0
-#define OCIE1A_BIT                              1
-#define OCIE1B_BIT                              1
-#define TICIE1_BIT                              0
+#define TOIE1_BIT                               2
+#define OCIE1B_BIT                              3
+#define OCIE1A_BIT                              4
+#define TICIE1_BIT                              5
 
 #define TOIE2_BIT                               6
 #define OCIE2_BIT                               7
@@ -54,6 +71,24 @@
 #define WGM20_BIT                               6
 #define WGM21_BIT                               3
 
+#define WGM10_BIT                               0   /*Bit Index inside the REG_TCCR1A*/
+#define COM1A1_BIT                              7   /*Bit Index inside the REG_TCCR1A*/
+#define WGM12_BIT                               3   /*Bit Index inside the REG_TCCR1B*/
+
+#define COM01_BIT                               5   /*Bit Index inside the REG_TCCR0*/
+#define COM21_BIT                               5   /*Bit Index inside the REG_TCCR2*/
+#define COM1B1_BIT                              5   /*Bit Index inside the REG_TCCR1A*/
+
+/*Output Compare Pins. The waveform is driven on them by the hardware when the COM Bits are set.*/
+#define OC0_PORT                                ENU_PORT_B
+#define OC0_PIN                                 3
+#define OC1A_PORT                               ENU_PORT_D
+#define OC1A_PIN                                5
+#define OC1B_PORT                               ENU_PORT_D
+#define OC1B_PIN                                4
+#define OC2_PORT                                ENU_PORT_D
+#define OC2_PIN                                 7
+
 #define TOV0_BIT                                0
 #define OCF0_BIT                                1
 #define TOV1_BIT                                2
@@ -65,6 +100,53 @@
 
 #define DISABLE_TIMER_MASK                      0xF8
 
+#define TCR2UB_BIT                              0   /*Bit Index inside the REG_ASSR*/
+#define OCR2UB_BIT                              1   /*Bit Index inside the REG_ASSR*/
+#define TCN2UB_BIT                              2   /*Bit Index inside the REG_ASSR*/
+#define AS2_BIT                                 3   /*Bit Index inside the REG_ASSR*/
+
+/*The Update Busy Flags of TCCR2, OCR2 and TCNT2. They're set while a written value is moved to the asynchronous clock domain.*/
+#define TIMER_2_UPDATE_BUSY_MASK                ((1<<TCR2UB_BIT) | (1<<OCR2UB_BIT) | (1<<TCN2UB_BIT))
+#define TIMER_2_WGM_MASK                        ((1<<WGM20_BIT) | (1<<WGM21_BIT))
+
+/*Timer 1 Waveform Generation Modes. WGM13:0 Bits. WGM11:10 are in TCCR1A and WGM13:12 are in TCCR1B.*/
+#define TIMER_1_WGM_NORMAL                      0
+#define TIMER_1_WGM_PHASE_PWM_8_BITS            1
+#define TIMER_1_WGM_PHASE_PWM_9_BITS            2
+#define TIMER_1_WGM_PHASE_PWM_10_BITS           3
+#define TIMER_1_WGM_CTC_OCR1A                   4
+#define TIMER_1_WGM_FAST_PWM_8_BITS             5
+#define TIMER_1_WGM_FAST_PWM_9_BITS             6
+#define TIMER_1_WGM_FAST_PWM_10_BITS            7
+#define TIMER_1_WGM_PHASE_FREQ_PWM_ICR1         8
+#define TIMER_1_WGM_PHASE_PWM_ICR1              10
+#define TIMER_1_WGM_CTC_ICR1                    12
+#define TIMER_1_WGM_FAST_PWM_ICR1               14
+#define TIMER_1_MAX_TOP_VALUE                   0xFFFF
+#define TIMER_1_MIN_TOP_VALUE                   0x0003  /*The minimum TOP allowed by the hardware in the PWM modes. (2 Bits Resolution)*/
+#define TIMER_1_WGM_LOW_BITS_MASK               0x03
+#define TIMER_1_WGM_HIGH_BITS_SHIFT             2
+
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_TCCR1A_WGM_MASK (WGM11:10 Bits)
+ * 
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| 0     | 0     | 0     | 0     | 0     | 0     |  1    | 1     |
+|---------------------------------------------------------------|
+*/
+#define REG_TCCR1A_WGM_MASK                     0x03
+
+/**
+ * @brief : Description of the @value: Assigned in @ref: REG_TCCR1B_WGM_MASK (WGM13:12 Bits)
+ * 
+|---------------------------------------------------------------|
+| Bit 7 | Bit 6 | Bit 5 | Bit 4 | Bit 3 | Bit 2 | Bit 1 | Bit 0 |
+| 0     | 0     | 0     | 1     | 1     | 0     |  0    | 0     |
+|---------------------------------------------------------------|
+*/
+#define REG_TCCR1B_WGM_MASK                     0x18
+
 
 /**
  * @brief: Sturcture that contains all the parameters needed to track the Timers configuration database.
@@ -77,8 +159,77 @@ typedef struct
     enum_timer_index_type               enum_timer_index_in_db;
     enum_timer_prescalar_value_type		enum_timer_prescalar_value_in_db;
     pointer_func_timer_callback_type    pointer_func_timer_callback_in_db;
+    uint32_type                         uint32_achieved_delay_ticks_in_db;
+    enum_timer_pwm_resolution_type      enum_timer_pwm_resolution_in_db;
+    enum_timer_clock_source_type        enum_timer_clock_source_in_db;
+    enum_timer_delay_mode_type          enum_timer_delay_mode_in_db;    /*TIMER_DELAY_INVALID: The callback is called on each period interrupt without @fn: timer_delay*/
 }struct_timer_database_type;
 
+/**
+ * @brief: Sturcture that contains the compile time parameters of each prescalar used in the delay calculations.
+ * 
+ */
+typedef struct
+{
+    enum_timer_prescalar_value_type     enum_timer_prescalar_value;
+    uint8_type                          uint8_prescalar_shift;
+    uint16_type                         uint16_ticks_per_ms;
+    uint16_type                         uint16_ticks_per_ms_remainder;
+    uint32_type                         uint32_max_delay_in_ms;
+    uint8_type                          uint8_is_timer_2_only;
+}struct_timer_prescalar_info_type;
+
+/**
+ * @brief: Sturcture that contains the result of splitting a delay on the timer interrupts.
+ * 
+ */
+typedef struct
+{
+    uint32_type                         uint32_number_of_interrupts;
+    uint32_type                         uint32_achieved_ticks;
+    uint16_type                         uint16_register_value;      /*The Preload Value in TIMER_MODE_OVF or the Compare Value in TIMER_MODE_CTC*/
+}struct_timer_delay_split_type;
+
+/**
+ * @brief: Sturcture that contains the state of the drift correction of a periodic delay in TIMER_MODE_CTC and TIMER_MODE_CTC_ICR.
+ *         Each period is split on short segments and long segments that are one tick longer. The long segments are the last ones of the period.
+ * 
+ */
+typedef struct
+{
+    uint16_type                         uint16_short_segment_value;         /*The Compare Value of the short segments.*/
+    uint16_type                         uint16_number_of_long_segments;     /*The remainder of dividing the period ticks on the interrupts.*/
+    uint16_type                         uint16_long_segments_in_period;     /*The long segments of the running period. It's one more when the fraction error carries.*/
+    uint16_type                         uint16_fraction_step;               /*The fraction of a tick that is added to each period. In (1 / prescalar) Ticks.*/
+    uint16_type                         uint16_fraction_error;              /*The accumulated fraction. It carries one tick when it reaches the prescalar.*/
+    uint16_type                         uint16_prescalar_value;
+}struct_timer_period_correction_type;
+
+static const struct_timer_prescalar_info_type global_arr_str_prescalar_info_table[] =
+{
+    {TIMER_NO_PRESCALAR,    0,  TIMER_TICKS_PER_MS(0),  TIMER_TICKS_PER_MS_REMAINDER(0),    TIMER_MAX_DELAY_IN_MS(0),   FALSE},
+    {TIMER_8_PRESCALAR,     3,  TIMER_TICKS_PER_MS(3),  TIMER_TICKS_PER_MS_REMAINDER(3),    TIMER_MAX_DELAY_IN_MS(3),   FALSE},
+    {TIMER_32_PRESCALAR,    5,  TIMER_TICKS_PER_MS(5),  TIMER_TICKS_PER_MS_REMAINDER(5),    TIMER_MAX_DELAY_IN_MS(5),   TRUE},
+    {TIMER_64_PRESCALAR,    6,  TIMER_TICKS_PER_MS(6),  TIMER_TICKS_PER_MS_REMAINDER(6),    TIMER_MAX_DELAY_IN_MS(6),   FALSE},
+    {TIMER_128_PRESCALAR,   7,  TIMER_TICKS_PER_MS(7),  TIMER_TICKS_PER_MS_REMAINDER(7),    TIMER_MAX_DELAY_IN_MS(7),   TRUE},
+    {TIMER_256_PRESCALAR,   8,  TIMER_TICKS_PER_MS(8),  TIMER_TICKS_PER_MS_REMAINDER(8),    TIMER_MAX_DELAY_IN_MS(8),   FALSE},
+    {TIMER_1024_PRESCALAR,  10, TIMER_TICKS_PER_MS(10), TIMER_TICKS_PER_MS_REMAINDER(10),   TIMER_MAX_DELAY_IN_MS(10),  FALSE}
+};
+
+/*Timer 1 Waveform Generation Mode and TOP of each PWM Resolution. The TOP of the 16 Bits Resolution is ICR1.*/
+static const uint8_type global_arr_uint8_timer_1_fast_pwm_mode_table[TIMER_PWM_RESOLUTION_INVALID] =
+{
+    TIMER_1_WGM_FAST_PWM_8_BITS, TIMER_1_WGM_FAST_PWM_9_BITS, TIMER_1_WGM_FAST_PWM_10_BITS, TIMER_1_WGM_FAST_PWM_ICR1
+};
+static const uint8_type global_arr_uint8_timer_1_phase_pwm_mode_table[TIMER_PWM_RESOLUTION_INVALID] =
+{
+    TIMER_1_WGM_PHASE_PWM_8_BITS, TIMER_1_WGM_PHASE_PWM_9_BITS, TIMER_1_WGM_PHASE_PWM_10_BITS, TIMER_1_WGM_PHASE_PWM_ICR1
+};
+static const uint16_type global_arr_uint16_timer_1_pwm_top_table[TIMER_PWM_RESOLUTION_INVALID] =
+{
+    0x00FF, 0x01FF, 0x03FF, TIMER_1_MAX_TOP_VALUE
+};
+
 #if (0)
 static struct_timer_database_type global_arr_str_timer_database[NUMBER_OF_SUPPORTED_TIMERS] =   {
                                                                                                     {
@@ -100,127 +251,221 @@ static struct_timer_database_type global_arr_str_timer_database[NUMBER_OF_SUPPOR
 
 static struct_timer_database_type   global_arr_str_timer_database[NUMBER_OF_SUPPORTED_TIMERS];
 static uint8_type                   global_bool_need_to_init_database           = TRUE;
-static volatile uint32_type         global_uint32_timer_0_needed_interrupts     = 0;
-static volatile uint32_type         global_uint32_timer_1_needed_interrupts     = 0;
-static volatile uint32_type         global_uint32_timer_2_needed_interrupts     = 0;
-static volatile uint32_type         global_uint32_ton_value                     = 0;
-static volatile uint32_type         global_uint32_toff_value                    = 0;
+/*  The ISR(s) count down the interrupts of each timer and reload the countdown after the callback. So they don't need 32 Bits statics.
+    Without a call to @fn: timer_delay the callback is raised on each period interrupt. (Ex: Once per PWM period or per 16 Bits Overflow)*/
+static volatile uint16_type         global_arr_uint16_timer_countdown[NUMBER_OF_SUPPORTED_TIMERS]   = {1, 1, 1};
+static volatile uint16_type         global_arr_uint16_timer_reload[NUMBER_OF_SUPPORTED_TIMERS]      = {1, 1, 1};
+/*A copy of the callback in the database. The ISR(s) read it directly instead of indexing the database.*/
+static pointer_func_timer_callback_type global_arr_pointer_func_timer_callback[NUMBER_OF_SUPPORTED_TIMERS] = {NULL_PTR, NULL_PTR, NULL_PTR};
 static enum_timer_index_type        global_enum_timer_index_with_polling        = TIMER_INDEX_INVALID;
 
-static void         init_timers_database(void);
-static sint32_type  delay_timer_0(uint32_type uint32_delay_in_ms);
-static sint32_type  delay_timer_1(uint32_type uint32_delay_in_ms);
-static sint32_type  delay_timer_2(uint32_type uint32_delay_in_ms);
-static sint32_type  generate_pwm_timer_0(uint8_type uint8_duty_cycle);
-static sint32_type  generate_pwm_timer_1(uint8_type uint8_duty_cycle);
-static sint32_type  generate_pwm_timer_2(uint8_type uint8_duty_cycle);
-static void         wait_for_timer_interrupt_flag(enum_timer_index_type enum_timer_index_with_polling);
+/*  The queue of the deferred callbacks. The ISR(s) are the only producer as they don't nest. @fn: timer_dispatcher is the only consumer.
+    So the tail is written by the ISR(s) only and the head by the main loop only. They are 8 Bits. So no lock is needed.*/
+static volatile uint8_type          global_arr_uint8_timer_event_queue[TIMER_EVENT_QUEUE_SIZE];
+static volatile uint8_type          global_uint8_timer_event_queue_head         = 0;
+static volatile uint8_type          global_uint8_timer_event_queue_tail         = 0;
+static volatile uint8_type          global_uint8_timer_event_queue_max_depth    = 0;
+static volatile uint16_type         global_uint16_timer_dropped_events          = 0;
+/*It's written by @fn: timer_delay while the timer is stopped. So the ISR(s) never see a half written state.*/
+static struct_timer_period_correction_type global_arr_str_timer_period_correction[NUMBER_OF_SUPPORTED_TIMERS];
+static pointer_func_timer_callback_type global_pointer_func_timer_1_compare_b_callback = NULL_PTR;
+static pointer_func_timer_callback_type global_pointer_func_timer_1_input_capture_callback = NULL_PTR;
 
+static void         init_timers_database(void);
+static void         set_timer_1_waveform_mode(uint8_type uint8_waveform_mode);
+static const struct_timer_prescalar_info_type* find_prescalar_info(enum_timer_prescalar_value_type enum_timer_prescalar_value);
+static sint32_type  calculate_delay_ticks(enum_timer_prescalar_value_type enum_timer_prescalar_value, uint32_type uint32_delay_in_ms, uint32_type* puint32_delay_ticks, uint16_type* puint16_delay_ticks_fraction);
+static void         set_timer_countdown(enum_timer_index_type enum_timer_index, uint16_type uint16_number_of_interrupts);
+static void         split_delay_ticks(enum_timer_mode_type enum_timer_mode, uint32_type uint32_delay_ticks, uint32_type uint32_counts_till_overflow, struct_timer_delay_split_type* pstr_delay_split);
+static void         split_periodic_delay_ticks(uint32_type uint32_delay_ticks, uint16_type uint16_delay_ticks_fraction, enum_timer_prescalar_value_type enum_timer_prescalar_value, uint32_type uint32_counts_till_overflow, struct_timer_delay_split_type* pstr_delay_split, struct_timer_period_correction_type* pstr_period_correction);
+static void         load_timer_segment(enum_timer_index_type enum_timer_index, uint8_type uint8_is_new_period);
+static void         stop_expired_timer(enum_timer_index_type enum_timer_index);
+static sint32_type  delay_timer_0(uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode);
+static sint32_type  delay_timer_1(uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode);
+static sint32_type  delay_timer_2(uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode);
+static uint16_type  calculate_pwm_compare_value(uint8_type uint8_duty_cycle, uint16_type uint16_top_value);
+static uint32_type  calculate_pwm_period_ticks(enum_timer_mode_type enum_timer_mode, uint16_type uint16_top_value);
+static sint32_type  generate_pwm_timer_0(enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle);
+static sint32_type  generate_pwm_timer_1(enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle);
+static sint32_type  generate_pwm_timer_2(enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle);
+static void         push_timer_event(enum_timer_index_type enum_timer_index);
+static uint8_type   get_timer_period_flag_bit(enum_timer_index_type enum_timer_index);
+static void         wait_for_timer_2_update(void);
+
+/*  The cost of one interrupt is measured on the target by test/timer_isr_benchmark.c. The call of the callback makes avr-gcc save all the call clobbered
+    registers in the prologue of each ISR. So the countdown path pays for them too, even when the callback is not called.*/
 ISR(TIMER0_OVF_vect)
 {
-    static volatile uint32_type uint32_local_interrupt_counter = 0;
-    uint32_local_interrupt_counter++;
-
-    if(uint32_local_interrupt_counter == global_uint32_timer_0_needed_interrupts)
+    global_arr_uint16_timer_countdown[TIMER_INDEX_0]--;
+    if(global_arr_uint16_timer_countdown[TIMER_INDEX_0] == 0)
     {
-        uint32_local_interrupt_counter     = 0;
-        if(global_arr_str_timer_database[TIMER_INDEX_0].pointer_func_timer_callback_in_db != NULL_PTR)
+        global_arr_uint16_timer_countdown[TIMER_INDEX_0] = global_arr_uint16_timer_reload[TIMER_INDEX_0];
+        if(global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
         {
-            global_arr_str_timer_database[TIMER_INDEX_0].pointer_func_timer_callback_in_db(TIMER_INDEX_0);
+            stop_expired_timer(TIMER_INDEX_0);
+        }
+        if(global_arr_pointer_func_timer_callback[TIMER_INDEX_0] != NULL_PTR)
+        {
+            global_arr_pointer_func_timer_callback[TIMER_INDEX_0](TIMER_INDEX_0);
         }
     }
 }
 
-#if defined (USE_CTC_FOR_PWM)
 ISR(TIMER0_COMP_vect)
 {
-	static volatile uint32_type uint32_local_interrupt_counter = 0;
-    if(uint32_local_interrupt_counter == 0)
-    {
-        uint32_local_interrupt_counter++;
-		//lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, REG_OCR0);
-        gpio_mainpulate_pin(ENU_OPERATION_TOGGLE, ENU_PORT_C, 2);
-        REG_OCR0 = global_uint32_toff_value;
-        /*Raise The Callback To The Upper Layer*/
-		//gpio_mainpulate_pin(ENU_OPERATION_TOGGLE, ENU_PORT_D, 3);
-    }
-    else if(uint32_local_interrupt_counter == 1)
-    {
-        uint32_local_interrupt_counter = 0;
-		//lcd_goto_row_column(1,0);
-		//lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, REG_OCR0);
-         gpio_mainpulate_pin(ENU_OPERATION_TOGGLE, ENU_PORT_C, 2);
-        REG_OCR0 = global_uint32_ton_value;
-        /*Raise The Callback To The Upper Layer*/
-        //gpio_mainpulate_pin(ENU_OPERATION_TOGGLE, ENU_PORT_D, 3);
-    }
-	
+    global_arr_uint16_timer_countdown[TIMER_INDEX_0]--;
+    if(global_arr_uint16_timer_countdown[TIMER_INDEX_0] == 0)
+    {
+        global_arr_uint16_timer_countdown[TIMER_INDEX_0] = global_arr_uint16_timer_reload[TIMER_INDEX_0];
+        if(global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+        {
+            load_timer_segment(TIMER_INDEX_0, TRUE);
+        }
+        else if(global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+        {
+            stop_expired_timer(TIMER_INDEX_0);
+        }
+        if(global_arr_pointer_func_timer_callback[TIMER_INDEX_0] != NULL_PTR)
+        {
+            global_arr_pointer_func_timer_callback[TIMER_INDEX_0](TIMER_INDEX_0);
+        }
+    }
+    else if(global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+    {
+        load_timer_segment(TIMER_INDEX_0, FALSE);
+    }
 }
-#else
-ISR(TIMER0_COMP_vect)
+
+/*  Timer 1 Interrupts. The Overflow is used in TIMER_MODE_OVF and the PWM modes. The Compare Match A is used in TIMER_MODE_CTC.
+    The Input Capture Flag is raised at TOP in TIMER_MODE_CTC_ICR. So its interrupt is used as the period interrupt in this mode.*/
+ISR(TIMER1_OVF_vect)
 {
-	static volatile uint32_type uint32_local_interrupt_counter = 0;
-	uint32_local_interrupt_counter++;
-
-	if(uint32_local_interrupt_counter == global_uint32_timer_0_needed_interrupts)
-	{
-		uint32_local_interrupt_counter     = 0;
-		if(global_arr_str_timer_database[TIMER_INDEX_0].pointer_func_timer_callback_in_db != NULL_PTR)
-		{
-			global_arr_str_timer_database[TIMER_INDEX_0].pointer_func_timer_callback_in_db(TIMER_INDEX_0);
-		}
-	}
+    global_arr_uint16_timer_countdown[TIMER_INDEX_1]--;
+    if(global_arr_uint16_timer_countdown[TIMER_INDEX_1] == 0)
+    {
+        global_arr_uint16_timer_countdown[TIMER_INDEX_1] = global_arr_uint16_timer_reload[TIMER_INDEX_1];
+        if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+        {
+            stop_expired_timer(TIMER_INDEX_1);
+        }
+        if(global_arr_pointer_func_timer_callback[TIMER_INDEX_1] != NULL_PTR)
+        {
+            global_arr_pointer_func_timer_callback[TIMER_INDEX_1](TIMER_INDEX_1);
+        }
+    }
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+    global_arr_uint16_timer_countdown[TIMER_INDEX_1]--;
+    if(global_arr_uint16_timer_countdown[TIMER_INDEX_1] == 0)
+    {
+        global_arr_uint16_timer_countdown[TIMER_INDEX_1] = global_arr_uint16_timer_reload[TIMER_INDEX_1];
+        if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+        {
+            load_timer_segment(TIMER_INDEX_1, TRUE);
+        }
+        else if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+        {
+            stop_expired_timer(TIMER_INDEX_1);
+        }
+        if(global_arr_pointer_func_timer_callback[TIMER_INDEX_1] != NULL_PTR)
+        {
+            global_arr_pointer_func_timer_callback[TIMER_INDEX_1](TIMER_INDEX_1);
+        }
+    }
+    else if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+    {
+        load_timer_segment(TIMER_INDEX_1, FALSE);
+    }
 }
-#endif
 
+ISR(TIMER1_CAPT_vect)
+{
+    /*In the other modes the flag is raised by an edge on the ICP1 Pin. (Or the Analog Comparator)*/
+    if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db != TIMER_MODE_CTC_ICR)
+    {
+        if(global_pointer_func_timer_1_input_capture_callback != NULL_PTR)
+        {
+            global_pointer_func_timer_1_input_capture_callback(TIMER_INDEX_1);
+        }
+    }
+    else
+    {
+        /*ICR1 is the TOP. So the flag is raised once per period.*/
+        global_arr_uint16_timer_countdown[TIMER_INDEX_1]--;
+        if(global_arr_uint16_timer_countdown[TIMER_INDEX_1] == 0)
+        {
+            global_arr_uint16_timer_countdown[TIMER_INDEX_1] = global_arr_uint16_timer_reload[TIMER_INDEX_1];
+            if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+            {
+                load_timer_segment(TIMER_INDEX_1, TRUE);
+            }
+            else if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+            {
+                stop_expired_timer(TIMER_INDEX_1);
+            }
+            if(global_arr_pointer_func_timer_callback[TIMER_INDEX_1] != NULL_PTR)
+            {
+                global_arr_pointer_func_timer_callback[TIMER_INDEX_1](TIMER_INDEX_1);
+            }
+        }
+        else if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+        {
+            load_timer_segment(TIMER_INDEX_1, FALSE);
+        }
+    }
+}
 
-ISR(TIMER2_OVF_vect)
+ISR(TIMER1_COMPB_vect)
 {
-	static volatile uint32_type uint32_local_interrupt_counter = 0;
-	uint32_local_interrupt_counter++;
-
-	if(uint32_local_interrupt_counter == global_uint32_timer_2_needed_interrupts)
-	{
-		uint32_local_interrupt_counter     = 0;
-		if(global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db != NULL_PTR)
-		{
-			global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db(TIMER_INDEX_2);
-		}
-	}
+    if(global_pointer_func_timer_1_compare_b_callback != NULL_PTR)
+    {
+        global_pointer_func_timer_1_compare_b_callback(TIMER_INDEX_1);
+    }
 }
 
-#if defined (USE_CTC_FOR_PWM)
-ISR(TIMER2_COMP_vect)
+ISR(TIMER2_OVF_vect)
 {
-	static volatile uint32_type uint32_local_interrupt_counter = 0;
-	uint32_local_interrupt_counter++;
-
-	if(uint32_local_interrupt_counter == global_uint32_timer_2_needed_interrupts)
-	{
-		uint32_local_interrupt_counter     = 0;
-		if(global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db != NULL_PTR)
-		{
-			global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db(TIMER_INDEX_2);
-		}
-	}
+    global_arr_uint16_timer_countdown[TIMER_INDEX_2]--;
+    if(global_arr_uint16_timer_countdown[TIMER_INDEX_2] == 0)
+    {
+        global_arr_uint16_timer_countdown[TIMER_INDEX_2] = global_arr_uint16_timer_reload[TIMER_INDEX_2];
+        if(global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+        {
+            stop_expired_timer(TIMER_INDEX_2);
+        }
+        if(global_arr_pointer_func_timer_callback[TIMER_INDEX_2] != NULL_PTR)
+        {
+            global_arr_pointer_func_timer_callback[TIMER_INDEX_2](TIMER_INDEX_2);
+        }
+    }
 }
-#else
+
 ISR(TIMER2_COMP_vect)
 {
-	static volatile uint32_type uint32_local_interrupt_counter = 0;
-	uint32_local_interrupt_counter++;
-
-	if(uint32_local_interrupt_counter == global_uint32_timer_2_needed_interrupts)
-	{
-		uint32_local_interrupt_counter     = 0;
-		if(global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db != NULL_PTR)
-		{
-			global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db(TIMER_INDEX_2);
-		}
-	}
+    global_arr_uint16_timer_countdown[TIMER_INDEX_2]--;
+    if(global_arr_uint16_timer_countdown[TIMER_INDEX_2] == 0)
+    {
+        global_arr_uint16_timer_countdown[TIMER_INDEX_2] = global_arr_uint16_timer_reload[TIMER_INDEX_2];
+        if(global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+        {
+            load_timer_segment(TIMER_INDEX_2, TRUE);
+        }
+        else if(global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+        {
+            stop_expired_timer(TIMER_INDEX_2);
+        }
+        if(global_arr_pointer_func_timer_callback[TIMER_INDEX_2] != NULL_PTR)
+        {
+            global_arr_pointer_func_timer_callback[TIMER_INDEX_2](TIMER_INDEX_2);
+        }
+    }
+    else if(global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+    {
+        load_timer_segment(TIMER_INDEX_2, FALSE);
+    }
 }
-#endif
-
 
 static void init_timers_database(void)
 {
@@ -232,202 +477,360 @@ static void init_timers_database(void)
         global_arr_str_timer_database[uint8_iterator].enum_timer_prescalar_value_in_db      = TIMER_INVALID_PRESCALAR;
         global_arr_str_timer_database[uint8_iterator].pointer_func_timer_callback_in_db     = NULL_PTR;
         global_arr_str_timer_database[uint8_iterator].uint8_is_timer_enabled_in_db          = FALSE;
+        global_arr_str_timer_database[uint8_iterator].uint32_achieved_delay_ticks_in_db     = 0;
+        global_arr_str_timer_database[uint8_iterator].enum_timer_pwm_resolution_in_db       = TIMER_PWM_RESOLUTION_8_BITS;
+        global_arr_str_timer_database[uint8_iterator].enum_timer_clock_source_in_db         = TIMER_CLOCK_SOURCE_CPU;
+        global_arr_str_timer_database[uint8_iterator].enum_timer_delay_mode_in_db           = TIMER_DELAY_INVALID;
 
     }
 }
 
-static sint32_type delay_timer_0(uint32_type uint32_delay_in_ms)
+/**
+ * @brief:  Function that is used to wait until the values written to TCCR2, OCR2 and TCNT2 are moved to the asynchronous clock domain.
+ *          A register shall not be written again while its Busy Flag is set. It takes up to 2 cycles of the crystal. (61 Micro Seconds)
+ *          The Busy Flags are always 0 when Timer 2 is clocked from the CPU. So it returns at once.
+ * @return  None
+ */
+static void wait_for_timer_2_update(void)
 {
-    sint32_type sint32_retval                               = SUCCESS_RETVAL;
-    uint8_type  uint8_preload_value                         = 0;
-    uint32_type uint32_number_of_interrupts                 = 0;
-    uint32_type uint32_time_to_overflow_in_ms               = 0;
-    uint32_type uint32_tick_time_in_ns                      = 0;
-    fint32_type float_exact_number_of_interrupts            = 0;
-
-    if  (
-            ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_OVF) ||
-            ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_CTC)
-        )
+    while((REG_ASSR & TIMER_2_UPDATE_BUSY_MASK) != 0)
     {
-        /*Calculate the Tick Time in Nano Seconds. In order to avoid losing fractions from the start of the calculations*/
-        uint32_tick_time_in_ns = ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_prescalar_value_in_db) * MUL_FACTOR) / (F_CPU / CONVERT_FROM_MILLI_TO_MICRO);
-
-        /*Calculate the time till overflow in Milli seconds*/
-        uint32_time_to_overflow_in_ms = ((uint32_tick_time_in_ns * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER) / CONVERT_FROM_NANO_TO_MILLI);
-        
-        /*Calculate the total number of Interrupts Needed.*/
-        float_exact_number_of_interrupts = (uint32_delay_in_ms * CONVERT_FROM_MILLI_TO_MICRO) / uint32_time_to_overflow_in_ms;
-        
-        /*Ceiling the Value of the needed interrupts. 
-        As if we needed 3.9 Interrupts. This means that we need 3 Interrupts from 0 to 255 and 1 interrupt with a preload value*/
-        uint32_number_of_interrupts = (uint32_type) float_exact_number_of_interrupts + 1;
-
-        /*Getting the fraction in the needed value for interrupts*/
-        float_exact_number_of_interrupts = float_exact_number_of_interrupts - uint32_number_of_interrupts;
+        /*Wait for the crystal clock.*/
+    }
+}
 
-        /*Storing the needed interrupts count in a global variable that will be checked inside the interrupt.*/
-        global_uint32_timer_0_needed_interrupts = uint32_number_of_interrupts;
+/**
+ * @brief:  Function that is used to write the Waveform Generation Mode of Timer 1. The WGM Bits are split on TCCR1A and TCCR1B.
+ * @return  None
+ */
+static void set_timer_1_waveform_mode(uint8_type uint8_waveform_mode)
+{
+    REG_TCCR1A = (REG_TCCR1A & (uint8_type)(~REG_TCCR1A_WGM_MASK)) | (uint8_waveform_mode & TIMER_1_WGM_LOW_BITS_MASK);
+    REG_TCCR1B = (REG_TCCR1B & (uint8_type)(~REG_TCCR1B_WGM_MASK)) | (uint8_type)((uint8_waveform_mode >> TIMER_1_WGM_HIGH_BITS_SHIFT) << WGM12_BIT);
+}
 
-        /*Calculating the needed preload value to store in the Register.*/
-        uint8_preload_value = OVERFLOW_VALUE_IN_8_BIT_TIMER - (float_exact_number_of_interrupts * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER);
+/**
+ * @brief:  Function that is used to find the compile time information of a prescalar.
+ * @return  Address of the entry in @ref: global_arr_str_prescalar_info_table or NULL_PTR in case of unsupported prescalar.
+ */
+static const struct_timer_prescalar_info_type* find_prescalar_info(enum_timer_prescalar_value_type enum_timer_prescalar_value)
+{
+    const struct_timer_prescalar_info_type* pstr_prescalar_info = NULL_PTR;
+    uint8_type                              uint8_iterator      = 0;
+    for(uint8_iterator = 0; uint8_iterator < FIND_ARR_LENGTH(global_arr_str_prescalar_info_table); uint8_iterator++)
+    {
+        if(global_arr_str_prescalar_info_table[uint8_iterator].enum_timer_prescalar_value == enum_timer_prescalar_value)
+        {
+            pstr_prescalar_info = &global_arr_str_prescalar_info_table[uint8_iterator];
+            break;
+        }
+    }
+    return pstr_prescalar_info;
+}
 
-        /*Storing the Preload value in the corresponding register based on timer mode.*/
-        if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_OVF)
+/**
+ * @brief:  Function that is used to convert a delay in Milli Seconds to Timer Ticks using 32 Bits integer math only.
+ *          ticks = ms * F_KHZ / prescalar. It's split on the integer and the fraction parts of (F_KHZ / prescalar). So no product overflows 32 Bits.
+ *          The truncated fraction of a tick is returned in (1 / prescalar) Ticks. It's the low Bits of the last product as the prescalar is a power of 2.
+ *          It's checked against a double precision reference for each prescalar by test/timer_host_test.c.
+ * @return  SUCCESS_RETVAL: In case of success.
+ *          ERROR_INVALID_ARGUMENTS: In case of unsupported prescalar.
+ *          ERROR_OUT_OF_BOUNDARY: In case that the delay needs more than 2^32 Ticks.
+ */
+static sint32_type calculate_delay_ticks(enum_timer_prescalar_value_type enum_timer_prescalar_value, uint32_type uint32_delay_in_ms, uint32_type* puint32_delay_ticks, uint16_type* puint16_delay_ticks_fraction)
+{
+    sint32_type                             sint32_retval       = SUCCESS_RETVAL;
+    const struct_timer_prescalar_info_type* pstr_prescalar_info = find_prescalar_info(enum_timer_prescalar_value);
+    uint32_type                             uint32_ticks        = 0;
+    uint32_type                             uint32_mask         = 0;
+    if(pstr_prescalar_info != NULL_PTR)
+    {
+        if(uint32_delay_in_ms <= pstr_prescalar_info->uint32_max_delay_in_ms)
         {
-            REG_TCNT0           = uint8_preload_value;
+            uint32_mask     = ((uint32_type)1 << pstr_prescalar_info->uint8_prescalar_shift) - 1;
+            uint32_ticks    = (uint32_delay_in_ms * pstr_prescalar_info->uint16_ticks_per_ms);
+            uint32_ticks   += ((uint32_delay_in_ms >> pstr_prescalar_info->uint8_prescalar_shift) * pstr_prescalar_info->uint16_ticks_per_ms_remainder);
+            uint32_ticks   += (((uint32_delay_in_ms & uint32_mask) * pstr_prescalar_info->uint16_ticks_per_ms_remainder) >> pstr_prescalar_info->uint8_prescalar_shift);
+            *puint16_delay_ticks_fraction = (uint16_type)(((uint32_delay_in_ms & uint32_mask) * pstr_prescalar_info->uint16_ticks_per_ms_remainder) & uint32_mask);
+            if(uint32_ticks == 0)
+            {
+                /*The delay is shorter than one tick of this prescalar.*/
+                uint32_ticks                    = 1;
+                *puint16_delay_ticks_fraction   = 0;
+            }
+            *puint32_delay_ticks = uint32_ticks;
         }
-        else if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_CTC)
+        else
         {
-            REG_OCR0           = uint8_preload_value;
+            sint32_retval = ERROR_OUT_OF_BOUNDARY;
         }
     }
     else
     {
-        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
     }
     return sint32_retval;
 }
 
-static sint32_type delay_timer_1(uint32_type uint32_delay_in_ms)
+/**
+ * @brief:  Function that is used to load the interrupts countdown of a timer. The ISR reloads it from the saved value after each callback.
+ *          The Interrupts are disabled while it's written. So the ISR never sees a half written 16 Bits value.
+ * @return  None
+ */
+static void set_timer_countdown(enum_timer_index_type enum_timer_index, uint16_type uint16_number_of_interrupts)
 {
-    sint32_type sint32_retval                               = SUCCESS_RETVAL;
-    uint16_type uint16_preload_value                        = 0;
-    uint32_type uint32_number_of_interrupts                 = 0;
-    uint32_type uint32_time_to_overflow_in_ms               = 0;
-    uint32_type uint32_tick_time_in_ns                      = 0;
-    fint32_type float_exact_number_of_interrupts            = 0;
+    uint8_type uint8_sreg = REG_SREG;
+    CLEAR_BIT(REG_SREG, I_BIT);
+    global_arr_uint16_timer_reload[enum_timer_index]    = uint16_number_of_interrupts;
+    global_arr_uint16_timer_countdown[enum_timer_index] = uint16_number_of_interrupts;
+    REG_SREG = uint8_sreg;
+}
 
-    if  (
-            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_OVF) ||
-            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_CTC)
-        )
+/**
+ * @brief:  Function that is used to queue the event of a deferred timer. It's called from the ISR(s) in place of the callback.
+ *          The event is dropped and counted when the queue is full. So the ISR never waits for the main loop.
+ * @return  None
+ */
+static void push_timer_event(enum_timer_index_type enum_timer_index)
+{
+    uint8_type uint8_tail       = global_uint8_timer_event_queue_tail;
+    uint8_type uint8_next_tail  = (uint8_type)((uint8_tail + 1) & TIMER_EVENT_QUEUE_MASK);
+    uint8_type uint8_depth      = 0;
+    if(uint8_next_tail == global_uint8_timer_event_queue_head)
     {
-        /*Calculate the Tick Time in Nano Seconds. In order to avoid losing fractions from the start of the calculations*/
-        uint32_tick_time_in_ns = ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_prescalar_value_in_db) * MUL_FACTOR) / (F_CPU / CONVERT_FROM_MILLI_TO_MICRO);
-
-        /*Calculate the time till overflow in Milli seconds*/
-        uint32_time_to_overflow_in_ms = ((uint32_tick_time_in_ns * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER) / CONVERT_FROM_NANO_TO_MILLI);
-        
-        /*Calculate the total number of Interrupts Needed.*/
-        float_exact_number_of_interrupts = (uint32_delay_in_ms * CONVERT_FROM_MILLI_TO_MICRO) / uint32_time_to_overflow_in_ms;
-        
-        /*Ceiling the Value of the needed interrupts. 
-        As if we needed 3.9 Interrupts. This means that we need 3 Interrupts from 0 to 255 and 1 interrupt with a preload value*/
-        uint32_number_of_interrupts = (uint32_type) float_exact_number_of_interrupts + 1;
-
-        /*Getting the fraction in the needed value for interrupts*/
-        float_exact_number_of_interrupts = float_exact_number_of_interrupts - uint32_number_of_interrupts;
-
-        /*Storing the needed interrupts count in a global variable that will be checked inside the interrupt.*/
-        global_uint32_timer_2_needed_interrupts = uint32_number_of_interrupts;
-
-        /*Calculating the needed preload value to store in the Register.*/
-        uint16_preload_value = OVERFLOW_VALUE_IN_8_BIT_TIMER - (float_exact_number_of_interrupts * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER);
+        if(global_uint16_timer_dropped_events < MAX_NUMBER_OF_DROPPED_EVENTS)
+        {
+            global_uint16_timer_dropped_events++;
+        }
+    }
+    else
+    {
+        /*The event is written before the tail is moved. So the main loop never reads an empty entry.*/
+        global_arr_uint8_timer_event_queue[uint8_tail]  = (uint8_type)enum_timer_index;
+        global_uint8_timer_event_queue_tail             = uint8_next_tail;
+        uint8_depth = (uint8_type)((uint8_next_tail - global_uint8_timer_event_queue_head) & TIMER_EVENT_QUEUE_MASK);
+        if(uint8_depth > global_uint8_timer_event_queue_max_depth)
+        {
+            global_uint8_timer_event_queue_max_depth = uint8_depth;
+        }
+    }
+}
 
-        /*Storing the Preload value in the corresponding register based on timer mode.*/
-        if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_OVF)
+/**
+ * @brief:  Function that is used to get the flag that is raised once per period in the configured mode of a timer.
+ * @return  The Bit Index inside the REG_TIFR.
+ */
+static uint8_type get_timer_period_flag_bit(enum_timer_index_type enum_timer_index)
+{
+    uint8_type              uint8_flag_bit  = TOV0_BIT;
+    enum_timer_mode_type    enum_timer_mode = global_arr_str_timer_database[enum_timer_index].enum_timer_mode_in_db;
+    if(enum_timer_index == TIMER_INDEX_0)
+    {
+        uint8_flag_bit = (enum_timer_mode == TIMER_MODE_CTC) ? OCF0_BIT : TOV0_BIT;
+    }
+    else if(enum_timer_index == TIMER_INDEX_1)
+    {
+        if(enum_timer_mode == TIMER_MODE_CTC)
         {
-            REG_TCNT1           = uint16_preload_value;
+            uint8_flag_bit = OCF1A_BIT;
         }
-        else if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_CTC)
+        else if(enum_timer_mode == TIMER_MODE_CTC_ICR)
         {
-            REG_OCR1A           = uint16_preload_value;
+            uint8_flag_bit = ICF1_BIT;
+        }
+        else
+        {
+            uint8_flag_bit = TOV1_BIT;
         }
     }
     else
     {
-        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        uint8_flag_bit = (enum_timer_mode == TIMER_MODE_CTC) ? OCF2_BIT : TOV2_BIT;
     }
-    return sint32_retval;
+    return uint8_flag_bit;
 }
 
-static sint32_type delay_timer_2(uint32_type uint32_delay_in_ms)
+/**
+ * @brief:  Function that is used to split the delay ticks on the timer interrupts.
+ *          TIMER_MODE_OVF: All the interrupts are full counts except the first one. It's shortened by preloading the counter. So the delay is exact.
+ *          TIMER_MODE_CTC: The delay is split on equal segments of ceil(ticks / counts) interrupts. So the error is less than half a tick per interrupt.
+ * @return  None
+ */
+static void split_delay_ticks(enum_timer_mode_type enum_timer_mode, uint32_type uint32_delay_ticks, uint32_type uint32_counts_till_overflow, struct_timer_delay_split_type* pstr_delay_split)
 {
-    sint32_type sint32_retval                               = SUCCESS_RETVAL;
-    uint8_type  uint8_preload_value                         = 0;
-    uint32_type uint32_number_of_interrupts                 = 0;
-    uint32_type uint32_time_to_overflow_in_ms               = 0;
-    uint32_type uint32_tick_time_in_ns                      = 0;
-    fint32_type float_exact_number_of_interrupts            = 0;
-
-    if  (
-            ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_OVF) ||
-            ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_CTC)
-        )
+    pstr_delay_split->uint32_number_of_interrupts = ((uint32_delay_ticks - 1) / uint32_counts_till_overflow) + 1;
+    if(enum_timer_mode == TIMER_MODE_OVF)
     {
-        /*Calculate the Tick Time in Nano Seconds. In order to avoid losing fractions from the start of the calculations*/
-        uint32_tick_time_in_ns = ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_prescalar_value_in_db) * MUL_FACTOR) / (F_CPU / CONVERT_FROM_MILLI_TO_MICRO);
-
-        /*Calculate the time till overflow in Milli seconds*/
-        uint32_time_to_overflow_in_ms = ((uint32_tick_time_in_ns * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER) / CONVERT_FROM_NANO_TO_MILLI);
-        
-        /*Calculate the total number of Interrupts Needed.*/
-        float_exact_number_of_interrupts = (uint32_delay_in_ms * CONVERT_FROM_MILLI_TO_MICRO) / uint32_time_to_overflow_in_ms;
-        
-        /*Ceiling the Value of the needed interrupts. 
-        As if we needed 3.9 Interrupts. This means that we need 3 Interrupts from 0 to 255 and 1 interrupt with a preload value*/
-        uint32_number_of_interrupts = (uint32_type) float_exact_number_of_interrupts + 1;
-
-        /*Getting the fraction in the needed value for interrupts*/
-        float_exact_number_of_interrupts = float_exact_number_of_interrupts - uint32_number_of_interrupts;
+        pstr_delay_split->uint16_register_value     = (uint16_type)((pstr_delay_split->uint32_number_of_interrupts * uint32_counts_till_overflow) - uint32_delay_ticks);
+        pstr_delay_split->uint32_achieved_ticks     = uint32_delay_ticks;
+    }
+    else
+    {
+        /*Rounded division. The Compare Value is the segment length minus 1.*/
+        uint32_type uint32_segment_ticks = (uint32_delay_ticks + (pstr_delay_split->uint32_number_of_interrupts / 2)) / pstr_delay_split->uint32_number_of_interrupts;
+        pstr_delay_split->uint16_register_value     = (uint16_type)(uint32_segment_ticks - 1);
+        pstr_delay_split->uint32_achieved_ticks     = uint32_segment_ticks * pstr_delay_split->uint32_number_of_interrupts;
+    }
+}
 
-        /*Storing the needed interrupts count in a global variable that will be checked inside the interrupt.*/
-        global_uint32_timer_2_needed_interrupts = uint32_number_of_interrupts;
+/**
+ * @brief:  Function that is used to split a periodic delay on the timer interrupts in TIMER_MODE_CTC and TIMER_MODE_CTC_ICR without drift.
+ *          The ticks of a period are split on short segments and (ticks % interrupts) long segments that are one tick longer. So each period is exact in ticks.
+ *          The fraction of a tick is accumulated from period to period like the Bresenham's line. It adds one long segment to the period in which it carries.
+ *          One more tick is kept free in the interrupts count for it. So the long segments never exceed the counter range.
+ * @return  None
+ */
+static void split_periodic_delay_ticks(uint32_type uint32_delay_ticks, uint16_type uint16_delay_ticks_fraction, enum_timer_prescalar_value_type enum_timer_prescalar_value, uint32_type uint32_counts_till_overflow, struct_timer_delay_split_type* pstr_delay_split, struct_timer_period_correction_type* pstr_period_correction)
+{
+    uint32_type uint32_max_period_ticks = uint32_delay_ticks;
+    uint32_type uint32_segment_ticks    = 0;
+    if(uint16_delay_ticks_fraction != 0)
+    {
+        uint32_max_period_ticks++;
+    }
+    pstr_delay_split->uint32_number_of_interrupts   = ((uint32_max_period_ticks - 1) / uint32_counts_till_overflow) + 1;
+    pstr_delay_split->uint32_achieved_ticks         = uint32_delay_ticks;
+    uint32_segment_ticks                            = uint32_delay_ticks / pstr_delay_split->uint32_number_of_interrupts;
+    pstr_delay_split->uint16_register_value         = (uint16_type)(uint32_segment_ticks - 1);
+
+    pstr_period_correction->uint16_short_segment_value      = pstr_delay_split->uint16_register_value;
+    pstr_period_correction->uint16_number_of_long_segments  = (uint16_type)(uint32_delay_ticks % pstr_delay_split->uint32_number_of_interrupts);
+    pstr_period_correction->uint16_long_segments_in_period  = pstr_period_correction->uint16_number_of_long_segments;
+    pstr_period_correction->uint16_fraction_step            = uint16_delay_ticks_fraction;
+    pstr_period_correction->uint16_fraction_error           = 0;
+    pstr_period_correction->uint16_prescalar_value          = (uint16_type)enum_timer_prescalar_value;
+}
 
-        /*Calculating the needed preload value to store in the Register.*/
-        uint8_preload_value = OVERFLOW_VALUE_IN_8_BIT_TIMER - (float_exact_number_of_interrupts * COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER);
+/**
+ * @brief:  Function that is used to load the Compare Value of the segment that has just started in a periodic delay.
+ *          The Compare Register is not double buffered in TIMER_MODE_CTC and TIMER_MODE_CTC_ICR and the counter has just been cleared.
+ *          So the new value applies to the running segment. It's called before the callback to keep the counter below the new value.
+ * @return  None
+ */
+static void load_timer_segment(enum_timer_index_type enum_timer_index, uint8_type uint8_is_new_period)
+{
+    struct_timer_period_correction_type*    pstr_period_correction  = &global_arr_str_timer_period_correction[enum_timer_index];
+    uint16_type                             uint16_segment_value    = pstr_period_correction->uint16_short_segment_value;
+    uint8_type                              uint8_sreg              = 0;
+    if(uint8_is_new_period == TRUE)
+    {
+        pstr_period_correction->uint16_long_segments_in_period  = pstr_period_correction->uint16_number_of_long_segments;
+        pstr_period_correction->uint16_fraction_error          += pstr_period_correction->uint16_fraction_step;
+        if(pstr_period_correction->uint16_fraction_error >= pstr_period_correction->uint16_prescalar_value)
+        {
+            pstr_period_correction->uint16_fraction_error      -= pstr_period_correction->uint16_prescalar_value;
+            pstr_period_correction->uint16_long_segments_in_period++;
+        }
+    }
+    /*The countdown is the number of the segments left in the period including the running one. The long segments are the last ones.*/
+    if(global_arr_uint16_timer_countdown[enum_timer_index] <= pstr_period_correction->uint16_long_segments_in_period)
+    {
+        uint16_segment_value++;
+    }
 
-        /*Storing the Preload value in the corresponding register based on timer mode.*/
-        if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_OVF)
+    if(enum_timer_index == TIMER_INDEX_0)
+    {
+        REG_OCR0 = (uint8_type)uint16_segment_value;
+    }
+    else if(enum_timer_index == TIMER_INDEX_1)
+    {
+        /*It's called from the main loop too in the polling mode. So the Interrupts are disabled while the 16 Bits Register is written through the shared TEMP Register.*/
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        if(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db == TIMER_MODE_CTC)
         {
-            REG_TCNT2           = uint8_preload_value;
+            REG_OCR1A = uint16_segment_value;
         }
-        else if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_CTC)
+        else
         {
-            REG_OCR2           = uint8_preload_value;
+            REG_ICR1 = uint16_segment_value;
         }
+        REG_SREG = uint8_sreg;
     }
     else
     {
-        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        REG_OCR2 = (uint8_type)uint16_segment_value;
     }
-    return sint32_retval;
 }
 
-static sint32_type generate_pwm_timer_0(uint8_type uint8_duty_cycle)
+/**
+ * @brief:  Function that is used to stop the clock of a timer on the expiry of a one shot delay. It's called from the ISR(s) before the callback.
+ *          So the timer doesn't raise another interrupt and the callback can start a new delay.
+ * @return  None
+ */
+static void stop_expired_timer(enum_timer_index_type enum_timer_index)
 {
-    sint32_type sint32_retval = SUCCESS_RETVAL;
-    if  (
-            ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_PWM)
-        )
+    if(enum_timer_index == TIMER_INDEX_0)
+    {
+        REG_TCCR0 = REG_TCCR0 & DISABLE_TIMER_MASK;
+    }
+    else if(enum_timer_index == TIMER_INDEX_1)
     {
-        /*Put Timer 0 PWM Generation Logic Here*/
-        global_uint32_ton_value = (uint8_duty_cycle * OVERFLOW_VALUE_IN_8_BIT_TIMER) / 100;
-        //lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, global_uint32_ton_value);
-        global_uint32_toff_value = OVERFLOW_VALUE_IN_8_BIT_TIMER - global_uint32_ton_value;
-        //lcd_goto_row_column(1,0);
-		//lcd_write_integral_data(LCD_INTEGRAL_DECIMAL, global_uint32_toff_value);
-		timer_enable(TIMER_INDEX_0);
-        REG_OCR0 = global_uint32_ton_value;
+        REG_TCCR1B = REG_TCCR1B & DISABLE_TIMER_MASK;
     }
     else
     {
-        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        REG_TCCR2 = REG_TCCR2 & DISABLE_TIMER_MASK;
     }
-    return sint32_retval;
+    global_arr_str_timer_database[enum_timer_index].uint8_is_timer_enabled_in_db = FALSE;
 }
 
-static sint32_type generate_pwm_timer_1(uint8_type uint8_duty_cycle)
+static sint32_type delay_timer_0(uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode)
 {
-    sint32_type sint32_retval = SUCCESS_RETVAL;
+    sint32_type                         sint32_retval               = SUCCESS_RETVAL;
+    uint32_type                         uint32_delay_ticks          = 0;
+    uint16_type                         uint16_delay_ticks_fraction = 0;
+    struct_timer_delay_split_type       str_delay_split;
+    struct_timer_period_correction_type str_period_correction;
+
+    /*In TIMER_MODE_OVF the preload can't be added again in the ISR without losing the ticks counted meanwhile. So the periodic delay needs TIMER_MODE_CTC.*/
     if  (
-            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_PWM)
+            (
+                ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_OVF) &&
+                (enum_timer_delay_mode == TIMER_DELAY_ONE_SHOT)
+            ) ||
+            ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_CTC)
         )
     {
-        /*Put Timer 1 PWM Generation Logic Here*/
-        global_uint32_ton_value = (uint8_duty_cycle * OVERFLOW_VALUE_IN_16_BIT_TIMER) / 100;
-        global_uint32_toff_value = OVERFLOW_VALUE_IN_16_BIT_TIMER - global_uint32_ton_value;
+        sint32_retval = calculate_delay_ticks(global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_prescalar_value_in_db, uint32_delay_in_ms, &uint32_delay_ticks, &uint16_delay_ticks_fraction);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            if(enum_timer_delay_mode == TIMER_DELAY_PERIODIC)
+            {
+                split_periodic_delay_ticks(uint32_delay_ticks, uint16_delay_ticks_fraction, global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_prescalar_value_in_db, COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER, &str_delay_split, &str_period_correction);
+            }
+            else
+            {
+                split_delay_ticks(global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db, uint32_delay_ticks, COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER, &str_delay_split);
+            }
+            if(str_delay_split.uint32_number_of_interrupts > MAX_NUMBER_OF_INTERRUPTS)
+            {
+                sint32_retval = ERROR_OUT_OF_BOUNDARY;
+            }
+            else
+            {
+                /*Storing the needed interrupts count in the countdown that will be checked inside the interrupt.*/
+                set_timer_countdown(TIMER_INDEX_0, (uint16_type)str_delay_split.uint32_number_of_interrupts);
+                global_arr_str_timer_database[TIMER_INDEX_0].uint32_achieved_delay_ticks_in_db = str_delay_split.uint32_achieved_ticks;
+
+                /*Storing the Preload value in the corresponding register based on timer mode.*/
+                if((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_OVF)
+                {
+                    REG_TCNT0           = (uint8_type)str_delay_split.uint16_register_value;
+                }
+                else if(enum_timer_delay_mode == TIMER_DELAY_PERIODIC)
+                {
+                    REG_TCNT0           = 0;
+                    global_arr_str_timer_period_correction[TIMER_INDEX_0] = str_period_correction;
+                    load_timer_segment(TIMER_INDEX_0, TRUE);
+                }
+                else
+                {
+                    REG_TCNT0           = 0;
+                    REG_OCR0            = (uint8_type)str_delay_split.uint16_register_value;
+                }
+            }
+        }
     }
     else
     {
@@ -436,26 +839,307 @@ static sint32_type generate_pwm_timer_1(uint8_type uint8_duty_cycle)
     return sint32_retval;
 }
 
-static sint32_type generate_pwm_timer_2(uint8_type uint8_duty_cycle)
+static sint32_type delay_timer_1(uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode)
 {
-    sint32_type sint32_retval = SUCCESS_RETVAL;
+    sint32_type                         sint32_retval               = SUCCESS_RETVAL;
+    uint32_type                         uint32_delay_ticks          = 0;
+    uint16_type                         uint16_delay_ticks_fraction = 0;
+    uint8_type                          uint8_sreg                  = 0;
+    struct_timer_delay_split_type       str_delay_split;
+    struct_timer_period_correction_type str_period_correction;
+
     if  (
-            ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_PWM) ||
-            ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_PHASE_PWM)
+            (
+                ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_OVF) &&
+                (enum_timer_delay_mode == TIMER_DELAY_ONE_SHOT)
+            ) ||
+            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_CTC) ||
+            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_CTC_ICR)
         )
     {
-        /*Put Timer 2 PWM Generation Logic Here*/
-        global_uint32_ton_value = (uint8_duty_cycle * OVERFLOW_VALUE_IN_8_BIT_TIMER) / 100;
-        global_uint32_toff_value = OVERFLOW_VALUE_IN_8_BIT_TIMER - global_uint32_ton_value;
-    }
-    else
-    {
-        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
-    }
-    return sint32_retval;
-}
-
-/**
+        sint32_retval = calculate_delay_ticks(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_prescalar_value_in_db, uint32_delay_in_ms, &uint32_delay_ticks, &uint16_delay_ticks_fraction);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            if(enum_timer_delay_mode == TIMER_DELAY_PERIODIC)
+            {
+                split_periodic_delay_ticks(uint32_delay_ticks, uint16_delay_ticks_fraction, global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_prescalar_value_in_db, COUNTS_TILL_OVERFLOW_IN_16_BIT_TIMER, &str_delay_split, &str_period_correction);
+            }
+            else
+            {
+                split_delay_ticks(global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db, uint32_delay_ticks, COUNTS_TILL_OVERFLOW_IN_16_BIT_TIMER, &str_delay_split);
+            }
+            if(str_delay_split.uint32_number_of_interrupts > MAX_NUMBER_OF_INTERRUPTS)
+            {
+                sint32_retval = ERROR_OUT_OF_BOUNDARY;
+            }
+            else
+            {
+                /*Storing the needed interrupts count in the countdown that will be checked inside the interrupt.*/
+                set_timer_countdown(TIMER_INDEX_1, (uint16_type)str_delay_split.uint32_number_of_interrupts);
+                global_arr_str_timer_database[TIMER_INDEX_1].uint32_achieved_delay_ticks_in_db = str_delay_split.uint32_achieved_ticks;
+
+                /*Storing the Preload value in the corresponding register based on timer mode.*/
+                /*The 16 Bits Registers are accessed through the shared TEMP Register. So the Interrupts are disabled.*/
+                uint8_sreg = REG_SREG;
+                CLEAR_BIT(REG_SREG, I_BIT);
+                if((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_OVF)
+                {
+                    REG_TCNT1           = str_delay_split.uint16_register_value;
+                }
+                else if(enum_timer_delay_mode == TIMER_DELAY_PERIODIC)
+                {
+                    REG_TCNT1           = 0;
+                    global_arr_str_timer_period_correction[TIMER_INDEX_1] = str_period_correction;
+                    load_timer_segment(TIMER_INDEX_1, TRUE);
+                }
+                else if((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_CTC)
+                {
+                    REG_TCNT1           = 0;
+                    REG_OCR1A           = str_delay_split.uint16_register_value;
+                }
+                else
+                {
+                    REG_TCNT1           = 0;
+                    REG_ICR1            = str_delay_split.uint16_register_value;
+                }
+                REG_SREG = uint8_sreg;
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+    }
+    return sint32_retval;
+}
+
+static sint32_type delay_timer_2(uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode)
+{
+    sint32_type                         sint32_retval               = SUCCESS_RETVAL;
+    uint32_type                         uint32_delay_ticks          = 0;
+    uint16_type                         uint16_delay_ticks_fraction = 0;
+    struct_timer_delay_split_type       str_delay_split;
+    struct_timer_period_correction_type str_period_correction;
+
+    /*The delay ticks are calculated from F_CPU. So the crystal clock is not supported.*/
+    if  (
+            ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_clock_source_in_db) == TIMER_CLOCK_SOURCE_CPU) &&
+            (
+                (
+                    ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_OVF) &&
+                    (enum_timer_delay_mode == TIMER_DELAY_ONE_SHOT)
+                ) ||
+                ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_CTC)
+            )
+        )
+    {
+        sint32_retval = calculate_delay_ticks(global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_prescalar_value_in_db, uint32_delay_in_ms, &uint32_delay_ticks, &uint16_delay_ticks_fraction);
+        if(sint32_retval == SUCCESS_RETVAL)
+        {
+            if(enum_timer_delay_mode == TIMER_DELAY_PERIODIC)
+            {
+                split_periodic_delay_ticks(uint32_delay_ticks, uint16_delay_ticks_fraction, global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_prescalar_value_in_db, COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER, &str_delay_split, &str_period_correction);
+            }
+            else
+            {
+                split_delay_ticks(global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db, uint32_delay_ticks, COUNTS_TILL_OVERFLOW_IN_8_BIT_TIMER, &str_delay_split);
+            }
+            if(str_delay_split.uint32_number_of_interrupts > MAX_NUMBER_OF_INTERRUPTS)
+            {
+                sint32_retval = ERROR_OUT_OF_BOUNDARY;
+            }
+            else
+            {
+                /*Storing the needed interrupts count in the countdown that will be checked inside the interrupt.*/
+                set_timer_countdown(TIMER_INDEX_2, (uint16_type)str_delay_split.uint32_number_of_interrupts);
+                global_arr_str_timer_database[TIMER_INDEX_2].uint32_achieved_delay_ticks_in_db = str_delay_split.uint32_achieved_ticks;
+
+                /*Storing the Preload value in the corresponding register based on timer mode.*/
+                if((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_OVF)
+                {
+                    REG_TCNT2           = (uint8_type)str_delay_split.uint16_register_value;
+                }
+                else if(enum_timer_delay_mode == TIMER_DELAY_PERIODIC)
+                {
+                    REG_TCNT2           = 0;
+                    global_arr_str_timer_period_correction[TIMER_INDEX_2] = str_period_correction;
+                    load_timer_segment(TIMER_INDEX_2, TRUE);
+                }
+                else
+                {
+                    REG_TCNT2           = 0;
+                    REG_OCR2            = (uint8_type)str_delay_split.uint16_register_value;
+                }
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:  Function that is used to convert the Duty Cycle in percent to a Compare Value between 0 and TOP.
+ * @return  The Compare Value.
+ */
+static uint16_type calculate_pwm_compare_value(uint8_type uint8_duty_cycle, uint16_type uint16_top_value)
+{
+    return (uint16_type)(((uint32_type)uint8_duty_cycle * uint16_top_value) / MAX_DUTY_CYCLE_VALUE);
+}
+
+/**
+ * @brief:  Function that is used to calculate the Ticks of one PWM period. The Phase Correct modes count up to TOP and down to BOTTOM. So their period is 2 * TOP.
+ * @return  The Ticks of one period.
+ */
+static uint32_type calculate_pwm_period_ticks(enum_timer_mode_type enum_timer_mode, uint16_type uint16_top_value)
+{
+    uint32_type uint32_period_ticks = 0;
+    if(enum_timer_mode == TIMER_MODE_PWM)
+    {
+        uint32_period_ticks = (uint32_type)uint16_top_value + 1;
+    }
+    else
+    {
+        uint32_period_ticks = (uint32_type)uint16_top_value << 1;
+    }
+    return uint32_period_ticks;
+}
+
+/*  In the PWM modes the Compare Registers are double buffered by the hardware and updated at TOP (or BOTTOM). So a new Duty Cycle never glitches the running period.
+    In the Fast PWM mode a Compare Value of 0 still gives a one Tick spike at BOTTOM. So the 0% Duty Cycle disconnects the pin and drives it low from the PORT.*/
+static sint32_type generate_pwm_timer_0(enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if  (
+            (enum_timer_compare_channel == TIMER_COMPARE_CHANNEL_A) &&
+            (
+                ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_PWM) ||
+                ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_PHASE_PWM)
+            )
+        )
+    {
+        gpio_set_pin_direction(OC0_PORT, OC0_PIN, ENU_DIRECTION_OUTPUT);
+        REG_OCR0 = (uint8_type)calculate_pwm_compare_value(uint8_duty_cycle, OVERFLOW_VALUE_IN_8_BIT_TIMER);
+        if((uint8_duty_cycle == MIN_DUTY_CYCLE_VALUE) && ((global_arr_str_timer_database[TIMER_INDEX_0].enum_timer_mode_in_db) == TIMER_MODE_PWM))
+        {
+            CLEAR_BIT(REG_TCCR0, COM01_BIT);
+            gpio_mainpulate_pin(ENU_OPERATION_CLEAR, OC0_PORT, OC0_PIN);
+        }
+        else
+        {
+            /*Non Inverting Output on OC0. (Cleared on Compare Match when up counting)*/
+            SET_BIT(REG_TCCR0, COM01_BIT);
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+    }
+    return sint32_retval;
+}
+
+static sint32_type generate_pwm_timer_1(enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle)
+{
+    sint32_type                     sint32_retval       = SUCCESS_RETVAL;
+    uint16_type                     uint16_top_value    = 0;
+    uint16_type                     uint16_compare_value= 0;
+    enum_supported_ports_t          enum_output_port    = OC1A_PORT;
+    uint8_type                      uint8_output_pin    = OC1A_PIN;
+    uint8_type                      uint8_com_bit       = COM1A1_BIT;
+    uint8_type                      uint8_sreg          = 0;
+    if  (
+            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_PWM)        ||
+            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_PHASE_PWM)  ||
+            ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_PHASE_FREQ_PWM)
+        )
+    {
+        /*The 8, 9 and 10 Bits Resolutions have a fixed TOP. The 16 Bits Resolution and the Phase and Frequency Correct mode use ICR1 as TOP.*/
+        if  (
+                ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_PHASE_FREQ_PWM) ||
+                ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_pwm_resolution_in_db) == TIMER_PWM_RESOLUTION_16_BITS)
+            )
+        {
+            /*The 16 Bits Registers are accessed through the shared TEMP Register. So the Interrupts are disabled.*/
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            uint16_top_value = REG_ICR1;
+            REG_SREG = uint8_sreg;
+        }
+        else
+        {
+            uint16_top_value = global_arr_uint16_timer_1_pwm_top_table[global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_pwm_resolution_in_db];
+        }
+        uint16_compare_value = calculate_pwm_compare_value(uint8_duty_cycle, uint16_top_value);
+
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        if(enum_timer_compare_channel == TIMER_COMPARE_CHANNEL_A)
+        {
+            REG_OCR1A = uint16_compare_value;
+        }
+        else
+        {
+            enum_output_port    = OC1B_PORT;
+            uint8_output_pin    = OC1B_PIN;
+            uint8_com_bit       = COM1B1_BIT;
+            REG_OCR1B           = uint16_compare_value;
+        }
+        REG_SREG = uint8_sreg;
+
+        gpio_set_pin_direction(enum_output_port, uint8_output_pin, ENU_DIRECTION_OUTPUT);
+        if((uint8_duty_cycle == MIN_DUTY_CYCLE_VALUE) && ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_mode_in_db) == TIMER_MODE_PWM))
+        {
+            CLEAR_BIT(REG_TCCR1A, uint8_com_bit);
+            gpio_mainpulate_pin(ENU_OPERATION_CLEAR, enum_output_port, uint8_output_pin);
+        }
+        else
+        {
+            /*Non Inverting Output on OC1A / OC1B. (Cleared on Compare Match when up counting)*/
+            SET_BIT(REG_TCCR1A, uint8_com_bit);
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+    }
+    return sint32_retval;
+}
+
+static sint32_type generate_pwm_timer_2(enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if  (
+            (enum_timer_compare_channel == TIMER_COMPARE_CHANNEL_A) &&
+            (
+                ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_PWM) ||
+                ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_PHASE_PWM)
+            )
+        )
+    {
+        gpio_set_pin_direction(OC2_PORT, OC2_PIN, ENU_DIRECTION_OUTPUT);
+        wait_for_timer_2_update();
+        REG_OCR2 = (uint8_type)calculate_pwm_compare_value(uint8_duty_cycle, OVERFLOW_VALUE_IN_8_BIT_TIMER);
+        if((uint8_duty_cycle == MIN_DUTY_CYCLE_VALUE) && ((global_arr_str_timer_database[TIMER_INDEX_2].enum_timer_mode_in_db) == TIMER_MODE_PWM))
+        {
+            CLEAR_BIT(REG_TCCR2, COM21_BIT);
+            gpio_mainpulate_pin(ENU_OPERATION_CLEAR, OC2_PORT, OC2_PIN);
+        }
+        else
+        {
+            /*Non Inverting Output on OC2. (Cleared on Compare Match when up counting)*/
+            SET_BIT(REG_TCCR2, COM21_BIT);
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+    }
+    return sint32_retval;
+}
+
+/**
  * @brief: 		Function that is used to initialize each timer.
  * 
  * @param[in] 	pstr_timer_config: 	Constant Pointer to Constant Structure that contains the Required Timer Configuration
@@ -483,7 +1167,26 @@ sint32_type timer_init(const tstr_timer_config* const pstr_timer_config)
                 ((pstr_timer_config->enum_timer_index) < TIMER_INDEX_INVALID) &&
                 ((pstr_timer_config->enum_timer_interrupt_usage) < TIMER_USAGE_INVALID) &&
                 ((pstr_timer_config->enum_timer_mode) < TIMER_MODE_INVALID) &&
-                ((pstr_timer_config->pointer_func_timer_callback) != NULL_PTR)
+                ((pstr_timer_config->pointer_func_timer_callback) != NULL_PTR) &&
+                ((pstr_timer_config->enum_timer_pwm_resolution) < TIMER_PWM_RESOLUTION_INVALID) &&
+                ((pstr_timer_config->enum_timer_clock_source) < TIMER_CLOCK_SOURCE_INVALID) &&
+                (find_prescalar_info(pstr_timer_config->enum_timer_prescalar_value) != NULL_PTR) &&
+                /*The Prescalars 32 and 128 and the Crystal Clock are supported by Timer 2 only.*/
+                (
+                    ((pstr_timer_config->enum_timer_index) == TIMER_INDEX_2) ||
+                    (
+                        ((pstr_timer_config->enum_timer_clock_source) == TIMER_CLOCK_SOURCE_CPU) &&
+                        ((find_prescalar_info(pstr_timer_config->enum_timer_prescalar_value)->uint8_is_timer_2_only) == FALSE)
+                    )
+                ) &&
+                /*The modes that use ICR1 as TOP and the PWM Resolutions above 8 Bits are supported by Timer 1 only.*/
+                (
+                    ((pstr_timer_config->enum_timer_index) == TIMER_INDEX_1) ||
+                    (
+                        ((pstr_timer_config->enum_timer_mode) < TIMER_MODE_CTC_ICR) &&
+                        ((pstr_timer_config->enum_timer_pwm_resolution) == TIMER_PWM_RESOLUTION_8_BITS)
+                    )
+                )
             )
         {
             if  (
@@ -499,13 +1202,13 @@ sint32_type timer_init(const tstr_timer_config* const pstr_timer_config)
                 {
                     case TIMER_INDEX_0:
                     {
-                        if((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_INTERRUPT)
+                        if(((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_INTERRUPT) || ((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_DEFERRED))
                         {
-                            if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_OVF)
+                            if((pstr_timer_config->enum_timer_mode) != TIMER_MODE_CTC)
                             {
                                 /*Enable Global Interrupt*/
                                 SET_BIT(REG_SREG, I_BIT);   
-                                /*Enable Peripheral Interrupt*/
+                                /*Enable Peripheral Interrupt. In the PWM modes it's raised once per period at BOTTOM.*/
                                 SET_BIT(REG_TIMSK, TOIE0_BIT);
                             }
                             else
@@ -548,43 +1251,113 @@ sint32_type timer_init(const tstr_timer_config* const pstr_timer_config)
 
                     case TIMER_INDEX_1:
                     {
-                        if((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_INTERRUPT)
+                        if(((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_INTERRUPT) || ((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_DEFERRED))
                         {
-                            /*Put Timer 1 Interrupt Configurations here.*/
+                            /*Enable Global Interrupt*/
+                            SET_BIT(REG_SREG, I_BIT);
+                            /*Enable Peripheral Interrupt. Each mode raises its period interrupt on a different flag.*/
+                            if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC)
+                            {
+                                SET_BIT(REG_TIMSK, OCIE1A_BIT);
+                            }
+                            else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC_ICR)
+                            {
+                                SET_BIT(REG_TIMSK, TICIE1_BIT);
+                            }
+                            else
+                            {
+                                SET_BIT(REG_TIMSK, TOIE1_BIT);
+                            }
                         }
                         else if((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_POLLING)
                         {
-                            /*Do Nothing.*/
+                            /*Do Nothing. Just save the timer index in the global to handle it in the timer dispatcher*/
+                            global_enum_timer_index_with_polling = TIMER_INDEX_1;
                         }
 
                         if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_OVF)
                         {
-                            /*Put Timer 1 Overflow configurations here.*/
+                            set_timer_1_waveform_mode(TIMER_1_WGM_NORMAL);
                         }
                         else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC)
                         {
-                            /*Put Timer 1 Clear Timer on Compare Match configurations here.*/
+                            set_timer_1_waveform_mode(TIMER_1_WGM_CTC_OCR1A);
                         }
                         else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PWM)
                         {
-                            /*Put Timer 1 Pulse Width Modulation configurations here.*/
+                            set_timer_1_waveform_mode(global_arr_uint8_timer_1_fast_pwm_mode_table[pstr_timer_config->enum_timer_pwm_resolution]);
                         }
                         else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PHASE_PWM)
                         {
-                            /*Put Timer 1 Fast Pulse Width Modulation configurations here.*/
+                            set_timer_1_waveform_mode(global_arr_uint8_timer_1_phase_pwm_mode_table[pstr_timer_config->enum_timer_pwm_resolution]);
+                        }
+                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC_ICR)
+                        {
+                            set_timer_1_waveform_mode(TIMER_1_WGM_CTC_ICR1);
+                        }
+                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PHASE_FREQ_PWM)
+                        {
+                            set_timer_1_waveform_mode(TIMER_1_WGM_PHASE_FREQ_PWM_ICR1);
+                        }
+
+                        /*Start the PWM modes that use ICR1 as TOP with the full 16 Bits period. It can be changed later by @ref: timer_set_top_value*/
+                        if  (
+                                ((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PHASE_FREQ_PWM) ||
+                                (
+                                    ((pstr_timer_config->enum_timer_pwm_resolution) == TIMER_PWM_RESOLUTION_16_BITS) &&
+                                    (((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PWM) || ((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PHASE_PWM))
+                                )
+                            )
+                        {
+                            REG_ICR1 = TIMER_1_MAX_TOP_VALUE;
                         }
                         break;
                     }
 
                     case TIMER_INDEX_2:
                     {
-                        if((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_INTERRUPT)
+                        /*  The Interrupts of Timer 2 are disabled while the clock source is switched. The switch may corrupt TCNT2, OCR2 and TCCR2.
+                            So they're written after it and the Interrupt Flags are cleared once the values are moved to the new clock domain.*/
+                        CLEAR_BIT(REG_TIMSK, TOIE2_BIT);
+                        CLEAR_BIT(REG_TIMSK, OCIE2_BIT);
+                        if((pstr_timer_config->enum_timer_clock_source) == TIMER_CLOCK_SOURCE_ASYNC_CRYSTAL)
+                        {
+                            SET_BIT(REG_ASSR, AS2_BIT);
+                        }
+                        else
+                        {
+                            CLEAR_BIT(REG_ASSR, AS2_BIT);
+                        }
+
+                        /*In the asynchronous mode each register is written once only before its Busy Flag is cleared.*/
+                        if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_OVF)
+                        {
+                            REG_TCCR2 = 0;
+                        }
+                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC)
+                        {
+                            REG_TCCR2 = (1<<WGM21_BIT);
+                        }
+                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PWM)
+                        {
+                            REG_TCCR2 = TIMER_2_WGM_MASK;
+                        }
+                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PHASE_PWM)
+                        {
+                            REG_TCCR2 = (1<<WGM20_BIT);
+                        }
+                        REG_TCNT2 = 0;
+                        REG_OCR2  = 0;
+                        wait_for_timer_2_update();
+                        REG_TIFR  = (1<<TOV2_BIT) | (1<<OCF2_BIT);
+
+                        if(((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_INTERRUPT) || ((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_DEFERRED))
                         {
-                            if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_OVF)
+                            if((pstr_timer_config->enum_timer_mode) != TIMER_MODE_CTC)
                             {
                                 /*Enable Global Interrupt*/
                                 SET_BIT(REG_SREG, I_BIT);   
-                                /*Enable Peripheral Interrupt*/
+                                /*Enable Peripheral Interrupt. In the PWM modes it's raised once per period at BOTTOM.*/
                                 SET_BIT(REG_TIMSK, TOIE2_BIT);
                             }
                             else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC)
@@ -600,27 +1373,6 @@ sint32_type timer_init(const tstr_timer_config* const pstr_timer_config)
                             /*Do Nothing. Just save the timer index in the global to handle it in the timer dispatcher*/
                             global_enum_timer_index_with_polling = TIMER_INDEX_2;
                         }
-
-                        if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_OVF)
-                        {
-                            CLEAR_BIT(REG_TCCR2, WGM20_BIT);
-                            CLEAR_BIT(REG_TCCR2, WGM21_BIT);
-                        }
-                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_CTC)
-                        {
-                            CLEAR_BIT(REG_TCCR2, WGM20_BIT);
-                            SET_BIT(REG_TCCR2, WGM21_BIT);
-                        }
-                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PWM)
-                        {
-                            SET_BIT(REG_TCCR2, WGM20_BIT);
-                            SET_BIT(REG_TCCR2, WGM21_BIT);
-                        }
-                        else if((pstr_timer_config->enum_timer_mode) == TIMER_MODE_PHASE_PWM)
-                        {
-                            SET_BIT(REG_TCCR2, WGM20_BIT);
-                            CLEAR_BIT(REG_TCCR2, WGM21_BIT);
-                        }
                         break;
                     }
 
@@ -639,6 +1391,19 @@ sint32_type timer_init(const tstr_timer_config* const pstr_timer_config)
                     global_arr_str_timer_database[pstr_timer_config->enum_timer_index].enum_timer_mode_in_db                = pstr_timer_config->enum_timer_mode;
                     global_arr_str_timer_database[pstr_timer_config->enum_timer_index].enum_timer_prescalar_value_in_db     = pstr_timer_config->enum_timer_prescalar_value;
                     global_arr_str_timer_database[pstr_timer_config->enum_timer_index].pointer_func_timer_callback_in_db    = pstr_timer_config->pointer_func_timer_callback;
+                    global_arr_str_timer_database[pstr_timer_config->enum_timer_index].enum_timer_pwm_resolution_in_db      = pstr_timer_config->enum_timer_pwm_resolution;
+                    global_arr_str_timer_database[pstr_timer_config->enum_timer_index].enum_timer_clock_source_in_db        = pstr_timer_config->enum_timer_clock_source;
+                    global_arr_str_timer_database[pstr_timer_config->enum_timer_index].enum_timer_delay_mode_in_db          = TIMER_DELAY_INVALID;
+                    /*The ISR of a deferred timer queues an event only. The callback in the database is called later by @fn: timer_dispatcher*/
+                    if((pstr_timer_config->enum_timer_interrupt_usage) == TIMER_USAGE_DEFERRED)
+                    {
+                        global_arr_pointer_func_timer_callback[pstr_timer_config->enum_timer_index]                         = push_timer_event;
+                    }
+                    else
+                    {
+                        global_arr_pointer_func_timer_callback[pstr_timer_config->enum_timer_index]                         = pstr_timer_config->pointer_func_timer_callback;
+                    }
+                    set_timer_countdown(pstr_timer_config->enum_timer_index, 1);
                 }
             }
             else
@@ -692,6 +1457,15 @@ sint32_type timer_deinit(enum_timer_index_type enum_timer_index)
             global_arr_str_timer_database[enum_timer_index].enum_timer_mode_in_db               = TIMER_MODE_INVALID;
             global_arr_str_timer_database[enum_timer_index].enum_timer_prescalar_value_in_db    = TIMER_INVALID_PRESCALAR;
             global_arr_str_timer_database[enum_timer_index].pointer_func_timer_callback_in_db   = NULL_PTR;
+            global_arr_pointer_func_timer_callback[enum_timer_index]                            = NULL_PTR;
+            if(global_enum_timer_index_with_polling == enum_timer_index)
+            {
+                global_enum_timer_index_with_polling = TIMER_INDEX_INVALID;
+            }
+            global_arr_str_timer_database[enum_timer_index].uint32_achieved_delay_ticks_in_db   = 0;
+            global_arr_str_timer_database[enum_timer_index].enum_timer_pwm_resolution_in_db     = TIMER_PWM_RESOLUTION_8_BITS;
+            global_arr_str_timer_database[enum_timer_index].enum_timer_clock_source_in_db       = TIMER_CLOCK_SOURCE_CPU;
+            global_arr_str_timer_database[enum_timer_index].enum_timer_delay_mode_in_db         = TIMER_DELAY_INVALID;
         }
     }
     else
@@ -773,11 +1547,44 @@ sint32_type timer_enable(enum_timer_index_type enum_timer_index)
                     case TIMER_INDEX_1:
                     {
                         /*Put the Sequence of Enabling Timer 1 Here*/
+                        switch(global_arr_str_timer_database[enum_timer_index].enum_timer_prescalar_value_in_db)
+                        {
+                            case TIMER_NO_PRESCALAR:
+                            {
+                                REG_TCCR1B = REG_TCCR1B | 0x01;
+                                break;
+                            }
+                            case TIMER_8_PRESCALAR:
+                            {
+                                REG_TCCR1B = REG_TCCR1B | 0x02;
+                                break;
+                            }
+                            case TIMER_64_PRESCALAR:
+                            {
+                                REG_TCCR1B = REG_TCCR1B | 0x03;
+                                break;
+                            }
+                            case TIMER_256_PRESCALAR:
+                            {
+                                REG_TCCR1B = REG_TCCR1B | 0x04;
+                                break;
+                            }
+                            case TIMER_1024_PRESCALAR:
+                            {
+                                REG_TCCR1B = REG_TCCR1B | 0x05;
+                                break;
+                            }
+                            default:
+                            {
+                                break;
+                            }
+                        }
                         break;
                     }
                     case TIMER_INDEX_2:
                     {
-                        /*Put the Sequence of Enabling Timer 2 Here*/
+                        /*Put the Sequence of Enabling Timer 2 Here. Its Clock Select values differ from Timer 0 and Timer 1 as it has the 32 and 128 Prescalars.*/
+                        wait_for_timer_2_update();
                         switch(global_arr_str_timer_database[enum_timer_index].enum_timer_prescalar_value_in_db)
                         {
                             case TIMER_NO_PRESCALAR:
@@ -790,26 +1597,38 @@ sint32_type timer_enable(enum_timer_index_type enum_timer_index)
                                 REG_TCCR2 = REG_TCCR2 | 0x02;
                                 break;
                             }
-                            case TIMER_64_PRESCALAR:
+                            case TIMER_32_PRESCALAR:
                             {
                                 REG_TCCR2 = REG_TCCR2 | 0x03;
                                 break;
                             }
-                            case TIMER_256_PRESCALAR:
+                            case TIMER_64_PRESCALAR:
                             {
                                 REG_TCCR2 = REG_TCCR2 | 0x04;
                                 break;
                             }
-                            case TIMER_1024_PRESCALAR:
+                            case TIMER_128_PRESCALAR:
                             {
                                 REG_TCCR2 = REG_TCCR2 | 0x05;
                                 break;
                             }
+                            case TIMER_256_PRESCALAR:
+                            {
+                                REG_TCCR2 = REG_TCCR2 | 0x06;
+                                break;
+                            }
+                            case TIMER_1024_PRESCALAR:
+                            {
+                                REG_TCCR2 = REG_TCCR2 | 0x07;
+                                break;
+                            }
                             default:
                             {
                                 break;
                             }
                         }
+                        /*The CPU shall not enter the Power Save Sleep before the new value is moved to the asynchronous clock domain.*/
+                        wait_for_timer_2_update();
                         break;
                     }
                     default:
@@ -878,12 +1697,15 @@ sint32_type timer_disable(enum_timer_index_type enum_timer_index)
                     case TIMER_INDEX_1:
                     {
                         /*Put the Sequence of Disabling Timer 1 Here*/
+                        REG_TCCR1B = REG_TCCR1B & DISABLE_TIMER_MASK;
                         break;
                     }
                     case TIMER_INDEX_2:
                     {
                         /*Put the Sequence of Disabling Timer 2 Here*/
+                        wait_for_timer_2_update();
                         REG_TCCR2 = REG_TCCR2 & DISABLE_TIMER_MASK;
+                        wait_for_timer_2_update();
                         break;
                     }
                     default:
@@ -914,20 +1736,23 @@ sint32_type timer_disable(enum_timer_index_type enum_timer_index)
 }
 
 /**
- * @brief:		Function that is used to set a specific delay value for a specific timer index.
- * @note:		The Delay will be done here is a single shot. 
- * 				This means that this delay will be done for one time only. After the timer finishes the delay value, it will execute the timer callback.
+ * @brief:		Function that is used to set a specific delay value for a specific timer index and start the timer.
+ * @note:		TIMER_DELAY_ONE_SHOT: The delay will be done for one time only. The timer is stopped on expiry. Then it will execute the timer callback.
+ * 				TIMER_DELAY_PERIODIC: The timer keeps running and executes the timer callback on each period until @fn: timer_disable is called.
  * 
  * @param[in] 	enum_timer_index: 	Enumeration for the specific timer index the user wants to delay.
  * @param[in] 	uint32_delay_in_ms: The specific delay value in Milli Seconds.
+ * @param[in] 	enum_timer_delay_mode: One Shot or Periodic.
  * @return 		SUCCESS_RETVAL: In case of success. 
  *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
  * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer is running or its mode doesn't support the delay mode. (Ex: TIMER_DELAY_PERIODIC in TIMER_MODE_OVF)
+ * 				ERROR_OUT_OF_BOUNDARY: In case that the delay needs more than 2^32 Timer Ticks or more than 65535 interrupts with the configured prescalar.
  */
-sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint32_delay_in_ms)
+sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode)
 {
     sint32_type sint32_retval = SUCCESS_RETVAL;
-    if((enum_timer_index < TIMER_INDEX_INVALID) && (uint32_delay_in_ms > MIN_DELAY_VALUE))
+    if((enum_timer_index < TIMER_INDEX_INVALID) && (uint32_delay_in_ms > MIN_DELAY_VALUE) && (enum_timer_delay_mode < TIMER_DELAY_INVALID))
     {
         if  (                    
                 ((global_arr_str_timer_database[enum_timer_index].uint8_is_timer_enabled_in_db) == FALSE)           && 
@@ -945,22 +1770,20 @@ sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint
             {
                 switch(enum_timer_index)
                 {
+                    /*The registers are programmed before starting the clock. So the first interrupt period is not shortened by the calculations time.*/
                     case TIMER_INDEX_0:
                     {
-                        timer_enable(TIMER_INDEX_0);
-                        sint32_retval = delay_timer_0(uint32_delay_in_ms);
+                        sint32_retval = delay_timer_0(uint32_delay_in_ms, enum_timer_delay_mode);
                         break;
                     }
                     case TIMER_INDEX_1:
                     {
-						timer_enable(TIMER_INDEX_1);
-                        sint32_retval = delay_timer_1(uint32_delay_in_ms);
+                        sint32_retval = delay_timer_1(uint32_delay_in_ms, enum_timer_delay_mode);
                         break;
                     }
                     case TIMER_INDEX_2:
                     {
-                        timer_enable(TIMER_INDEX_2);
-                        sint32_retval = delay_timer_2(uint32_delay_in_ms);
+                        sint32_retval = delay_timer_2(uint32_delay_in_ms, enum_timer_delay_mode);
                         break;
                     }
                     default:
@@ -969,6 +1792,11 @@ sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint
                         break;
                     }
                 }
+                if(sint32_retval == SUCCESS_RETVAL)
+                {
+                    global_arr_str_timer_database[enum_timer_index].enum_timer_delay_mode_in_db = enum_timer_delay_mode;
+                    timer_enable(enum_timer_index);
+                }
             }
             else
             {
@@ -984,18 +1812,37 @@ sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint
 }
 
 /**
- * @brief:		Function that is used to generate a PWM (Pulse Width Modulation) for the timer
+ * @brief:		Function that is used to generate a PWM (Pulse Width Modulation) on the Compare Channel A of the timer. (OC0, OC1A or OC2 Pin)
  * 
  * @param[in] 	enum_timer_index: 	Enumeration for the specific timer index the user wants to generate a PWM on it. 
- * @param[in] 	uint8_duty_cycle:	Timer Duty Cycle the user wants to generate on the timer. 
+ * @param[in] 	uint8_duty_cycle:	Timer Duty Cycle in percent the user wants to generate on the timer. From 0 to 100.
  * @return 		SUCCESS_RETVAL: In case of success. 
  *  			ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
- * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer was not configured in the @fn: timer_init in the @member: enum_timer_mode in the @struct: tstr_timer_config was not equal to TIMER_MODE_PWM | TIMER_MODE_PHASE_PWM
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer was not configured in the @fn: timer_init in the @member: enum_timer_mode_type in the @struct: tstr_timer_config was not equal to TIMER_MODE_PWM | TIMER_MODE_PHASE_PWM | TIMER_MODE_PHASE_FREQ_PWM
  */
 sint32_type	timer_generate_pwm(enum_timer_index_type enum_timer_index, uint8_type uint8_duty_cycle)
+{
+    sint32_type sint32_retval = timer_generate_pwm_on_channel(enum_timer_index, TIMER_COMPARE_CHANNEL_A, uint8_duty_cycle);
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to generate a PWM (Pulse Width Modulation) on a specific Compare Channel of the timer.
+ * 				The waveform is driven on the Output Compare Pin by the hardware. So no interrupt is needed to generate it.
+ * 				It can be called while the timer runs to change the Duty Cycle. The new value is applied at the end of the current period without glitches.
+ * 
+ * @param[in] 	enum_timer_index: 			Enumeration for the specific timer index the user wants to generate a PWM on it. 
+ * @param[in] 	enum_timer_compare_channel:	The Output Compare Channel. @note: Timer 0 and Timer 2 support TIMER_COMPARE_CHANNEL_A only.
+ * @param[in] 	uint8_duty_cycle:			Timer Duty Cycle in percent the user wants to generate on the timer. From 0 to 100.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *  			ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer is not configured in a PWM mode or the channel is not supported by this timer.
+ */
+sint32_type	timer_generate_pwm_on_channel(enum_timer_index_type enum_timer_index, enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle)
 {
     sint32_type sint32_retval = SUCCESS_RETVAL;
-    if((enum_timer_index < TIMER_INDEX_INVALID) && (uint8_duty_cycle > MIN_DUTY_CYCLE_VALUE) && (uint8_duty_cycle < MAX_DUTY_CYCLE_VALUE))
+    if((enum_timer_index < TIMER_INDEX_INVALID) && (enum_timer_compare_channel < TIMER_COMPARE_CHANNEL_INVALID) && (uint8_duty_cycle <= MAX_DUTY_CYCLE_VALUE))
     {
         if  (                    
                 ((global_arr_str_timer_database[enum_timer_index].uint8_is_timer_enabled_in_db) == FALSE)           && 
@@ -1009,37 +1856,116 @@ sint32_type	timer_generate_pwm(enum_timer_index_type enum_timer_index, uint8_typ
         }
         else
         {
-            if((global_arr_str_timer_database[enum_timer_index].uint8_is_timer_enabled_in_db) == FALSE)
+            switch(enum_timer_index)
             {
-                switch(enum_timer_index)
+                case TIMER_INDEX_0:
                 {
-                    case TIMER_INDEX_0:
-                    {
-                        sint32_retval = generate_pwm_timer_0(uint8_duty_cycle);
-                        break;
+                    sint32_retval = generate_pwm_timer_0(enum_timer_compare_channel, uint8_duty_cycle);
+                    break;
+                }
+                case TIMER_INDEX_1:
+                {
+                    sint32_retval = generate_pwm_timer_1(enum_timer_compare_channel, uint8_duty_cycle);
+                    break;
+                }
+                case TIMER_INDEX_2:
+                {
+                    sint32_retval = generate_pwm_timer_2(enum_timer_compare_channel, uint8_duty_cycle);
+                    break;
+                }
+                default:
+                {
+                    sint32_retval = ERROR_OUT_OF_BOUNDARY;
+                    break;
+                }
+            }
+
+            /*The Compare Value is written before the clock is started. So the first period has the right Duty Cycle.*/
+            if((sint32_retval == SUCCESS_RETVAL) && ((global_arr_str_timer_database[enum_timer_index].uint8_is_timer_enabled_in_db) == FALSE))
+            {
+                sint32_retval = timer_enable(enum_timer_index);
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to write the Output Compare Register of a specific timer channel directly in Timer Ticks.
+ * 				This can be used to set the period of a timer in TIMER_MODE_CTC (Ex: As an ADC Auto Trigger Source).
+ * 
+ * @param[in] 	enum_timer_index: 			Enumeration for the specific timer index.
+ * @param[in] 	enum_timer_compare_channel:	The Output Compare Channel. @note: Timer 0 and Timer 2 support TIMER_COMPARE_CHANNEL_A only.
+ * @param[in] 	uint16_compare_value:		The Compare Value. @note: This shall not exceed 255 for Timer 0 and Timer 2.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ */
+sint32_type timer_set_compare_value(enum_timer_index_type enum_timer_index, enum_timer_compare_channel_type enum_timer_compare_channel, uint16_type uint16_compare_value)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg    = 0;
+    if((enum_timer_index < TIMER_INDEX_INVALID) && (enum_timer_compare_channel < TIMER_COMPARE_CHANNEL_INVALID))
+    {
+        if((global_arr_str_timer_database[enum_timer_index].enum_timer_index_in_db) == TIMER_INDEX_INVALID)
+        {
+            /*This means that this timer doesn't have a saved configuration parameters in the database. So it's not initialized previously.*/
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else
+        {
+            switch(enum_timer_index)
+            {
+                case TIMER_INDEX_0:
+                {
+                    if((enum_timer_compare_channel == TIMER_COMPARE_CHANNEL_A) && (uint16_compare_value <= OVERFLOW_VALUE_IN_8_BIT_TIMER))
+                    {
+                        REG_OCR0 = (uint8_type)uint16_compare_value;
                     }
-                    case TIMER_INDEX_1:
+                    else
                     {
-                        timer_enable(TIMER_INDEX_1);
-                        sint32_retval = generate_pwm_timer_1(uint8_duty_cycle);
-                        break;
+                        sint32_retval = ERROR_INVALID_ARGUMENTS;
                     }
-                    case TIMER_INDEX_2:
+                    break;
+                }
+                case TIMER_INDEX_1:
+                {
+                    /*The 16 Bits Registers are accessed through the shared TEMP Register. So the Interrupts are disabled.*/
+                    uint8_sreg = REG_SREG;
+                    CLEAR_BIT(REG_SREG, I_BIT);
+                    if(enum_timer_compare_channel == TIMER_COMPARE_CHANNEL_A)
                     {
-                        timer_enable(TIMER_INDEX_2);
-                        sint32_retval = generate_pwm_timer_2(uint8_duty_cycle);
-                        break;
+                        REG_OCR1A = uint16_compare_value;
                     }
-                    default:
+                    else
                     {
-                        sint32_retval = ERROR_OUT_OF_BOUNDARY;
-                        break;
+                        REG_OCR1B = uint16_compare_value;
                     }
+                    REG_SREG = uint8_sreg;
+                    break;
+                }
+                case TIMER_INDEX_2:
+                {
+                    if((enum_timer_compare_channel == TIMER_COMPARE_CHANNEL_A) && (uint16_compare_value <= OVERFLOW_VALUE_IN_8_BIT_TIMER))
+                    {
+                        wait_for_timer_2_update();
+                        REG_OCR2 = (uint8_type)uint16_compare_value;
+                    }
+                    else
+                    {
+                        sint32_retval = ERROR_INVALID_ARGUMENTS;
+                    }
+                    break;
+                }
+                default:
+                {
+                    sint32_retval = ERROR_OUT_OF_BOUNDARY;
+                    break;
                 }
-            }
-            else
-            {
-                sint32_retval = ERROR_UNSUPPORTED_FEATURE;
             }
         }
     }
@@ -1050,90 +1976,441 @@ sint32_type	timer_generate_pwm(enum_timer_index_type enum_timer_index, uint8_typ
     return sint32_retval;
 }
 
-#if 0
-void timer_dispatcher(void)
-{
-    wait_for_timer_interrupt_flag(global_enum_timer_index_with_polling);
-}
-static void wait_for_timer_interrupt_flag(enum_timer_index_type enum_timer_index_with_polling)
+/**
+ * @brief:		Function that is used to write the TOP value (ICR1) of Timer 1 in the modes that use ICR1 as TOP.
+ * 				This sets the period to (TOP + 1) Ticks in TIMER_MODE_CTC_ICR and to 2 * TOP Ticks in TIMER_MODE_PHASE_FREQ_PWM.
+ * 
+ * @param[in] 	enum_timer_index: 		Enumeration for the specific timer index. @note: Only TIMER_INDEX_1 is supported.
+ * @param[in] 	uint16_top_value:		The TOP Value.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer has no ICR1 Register.
+ */
+sint32_type timer_set_top_value(enum_timer_index_type enum_timer_index, uint16_type uint16_top_value)
 {
-    static uint32_type uint32_local_interrupt_counter = 0;
-    uint8_type uint8_is_valid_timer_index = TRUE;
-    switch(enum_timer_index_with_polling)
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg    = 0;
+    if(enum_timer_index < TIMER_INDEX_INVALID)
     {
-        case TIMER_INDEX_0:
-        case TIMER_INDEX_1:
-        case TIMER_INDEX_2:
+        if(enum_timer_index != TIMER_INDEX_1)
         {
-            break;
+            sint32_retval = ERROR_UNSUPPORTED_FEATURE;
         }
-        default:
+        else if((global_arr_str_timer_database[enum_timer_index].enum_timer_index_in_db) == TIMER_INDEX_INVALID)
         {
-            uint8_is_valid_timer_index = FALSE;
-            break;
+            /*This means that this timer doesn't have a saved configuration parameters in the database. So it's not initialized previously.*/
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else
+        {
+            /*The 16 Bits Registers are accessed through the shared TEMP Register. So the Interrupts are disabled.*/
+            uint8_sreg = REG_SREG;
+            CLEAR_BIT(REG_SREG, I_BIT);
+            REG_ICR1 = uint16_top_value;
+            REG_SREG = uint8_sreg;
         }
     }
-    
-    if(uint8_is_valid_timer_index == TRUE)
+    else
     {
-        if(global_arr_str_timer_database[enum_timer_index_with_polling].enum_timer_mode_in_db == TIMER_MODE_OVF)
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to select the prescalar and the TOP of a timer in a PWM mode from a target PWM Frequency.
+ * 				Timer 1 with TIMER_PWM_RESOLUTION_16_BITS or in TIMER_MODE_PHASE_FREQ_PWM uses ICR1 as TOP. So the smallest prescalar that fits the period in 16 Bits is selected to get the finest Duty Cycle.
+ * 				(Ex: 20 KHz Fast PWM @ 16 MHz: No Prescalar and TOP = 799. So the Duty Cycle has 800 steps)
+ * 				The other modes have a fixed TOP. So only the prescalar is selected and the nearest period is taken.
+ * 				The Phase Correct modes count up and down. So their period is 2 * TOP Ticks instead of (TOP + 1) Ticks.
+ * @note:		The Compare Values are rescaled to the new TOP. So the Duty Cycles are kept.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index.
+ * @param[in] 	uint32_frequency_in_hz:			The target PWM Frequency in Hz.
+ * @param[out] 	pstr_timer_pwm_frequency_info:	Address of a structure in which the achieved frequency, TOP and prescalar will be stored.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer is not configured in a PWM mode.
+ * 				ERROR_OUT_OF_BOUNDARY: In case that the frequency can't be reached with ICR1 as TOP. (TOP shall be from 3 to 0xFFFF)
+ */
+sint32_type timer_set_pwm_frequency(enum_timer_index_type enum_timer_index, uint32_type uint32_frequency_in_hz, tstr_timer_pwm_frequency_info* pstr_timer_pwm_frequency_info)
+{
+    sint32_type             sint32_retval               = SUCCESS_RETVAL;
+    enum_timer_mode_type    enum_timer_mode             = TIMER_MODE_INVALID;
+    uint8_type              uint8_is_top_in_icr1        = FALSE;
+    uint8_type              uint8_is_timer_enabled      = FALSE;
+    uint8_type              uint8_iterator              = 0;
+    uint8_type              uint8_selected_index        = FIND_ARR_LENGTH(global_arr_str_prescalar_info_table);
+    uint8_type              uint8_prescalar_shift       = 0;
+    uint8_type              uint8_sreg                  = 0;
+    uint16_type             uint16_top_value            = 0;
+    uint16_type             uint16_old_top_value        = 0;
+    uint32_type             uint32_period_cycles        = 0;
+    uint32_type             uint32_period_ticks         = 0;
+    uint32_type             uint32_candidate_top_value  = 0;
+    uint32_type             uint32_error_cycles         = 0;
+    uint32_type             uint32_min_error_cycles     = 0xFFFFFFFFUL;
+    if((enum_timer_index < TIMER_INDEX_INVALID) && (uint32_frequency_in_hz != 0) && (pstr_timer_pwm_frequency_info != NULL_PTR))
+    {
+        enum_timer_mode = global_arr_str_timer_database[enum_timer_index].enum_timer_mode_in_db;
+        if((global_arr_str_timer_database[enum_timer_index].enum_timer_index_in_db) == TIMER_INDEX_INVALID)
+        {
+            /*This means that this timer doesn't have a saved configuration parameters in the database. So it's not initialized previously.*/
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else if (
+                    ((enum_timer_mode != TIMER_MODE_PWM) && (enum_timer_mode != TIMER_MODE_PHASE_PWM) && (enum_timer_mode != TIMER_MODE_PHASE_FREQ_PWM)) ||
+                    ((global_arr_str_timer_database[enum_timer_index].enum_timer_clock_source_in_db) != TIMER_CLOCK_SOURCE_CPU)
+                )
         {
-            if(enum_timer_index_with_polling == TIMER_INDEX_0)
+            sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        }
+        else
+        {
+            /*The target period in CPU Cycles. It's rounded to the nearest cycle.*/
+            uint32_period_cycles = (F_CPU + (uint32_frequency_in_hz >> 1)) / uint32_frequency_in_hz;
+            if  (
+                    (enum_timer_index == TIMER_INDEX_1) &&
+                    (
+                        (enum_timer_mode == TIMER_MODE_PHASE_FREQ_PWM) ||
+                        ((global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_pwm_resolution_in_db) == TIMER_PWM_RESOLUTION_16_BITS)
+                    )
+                )
             {
-                while(GET_BIT(REG_TIFR, TOV0_BIT) == 1);
-                uint32_local_interrupt_counter++;
-                if(uint32_local_interrupt_counter == global_uint32_timer_0_needed_interrupts)
+                uint8_is_top_in_icr1 = TRUE;
+                /*The prescalars are sorted ascending. So the first one that fits the period in 16 Bits gives the largest TOP.*/
+                for(uint8_iterator = 0; (uint8_iterator < FIND_ARR_LENGTH(global_arr_str_prescalar_info_table)) && (uint8_selected_index == FIND_ARR_LENGTH(global_arr_str_prescalar_info_table)); uint8_iterator++)
+                {
+                    uint8_prescalar_shift   = global_arr_str_prescalar_info_table[uint8_iterator].uint8_prescalar_shift;
+                    uint32_period_ticks     = (uint32_period_cycles + ((1UL << uint8_prescalar_shift) >> 1)) >> uint8_prescalar_shift;
+                    if(enum_timer_mode == TIMER_MODE_PWM)
+                    {
+                        uint32_candidate_top_value = (uint32_period_ticks > 0) ? (uint32_period_ticks - 1) : 0;
+                    }
+                    else
+                    {
+                        uint32_candidate_top_value = (uint32_period_ticks + 1) >> 1;
+                    }
+                    if((uint32_candidate_top_value <= TIMER_1_MAX_TOP_VALUE) && ((global_arr_str_prescalar_info_table[uint8_iterator].uint8_is_timer_2_only) == FALSE))
+                    {
+                        uint8_selected_index    = uint8_iterator;
+                        uint16_top_value        = (uint16_type)uint32_candidate_top_value;
+                    }
+                }
+                if((uint8_selected_index == FIND_ARR_LENGTH(global_arr_str_prescalar_info_table)) || (uint16_top_value < TIMER_1_MIN_TOP_VALUE))
                 {
-                    global_arr_str_timer_database[TIMER_INDEX_0].pointer_func_timer_callback_in_db(TIMER_INDEX_0);
+                    sint32_retval = ERROR_OUT_OF_BOUNDARY;
                 }
             }
-            else if(enum_timer_index_with_polling == TIMER_INDEX_1)
+            else
             {
-
+                if(enum_timer_index == TIMER_INDEX_1)
+                {
+                    uint16_top_value = global_arr_uint16_timer_1_pwm_top_table[global_arr_str_timer_database[TIMER_INDEX_1].enum_timer_pwm_resolution_in_db];
+                }
+                else
+                {
+                    uint16_top_value = OVERFLOW_VALUE_IN_8_BIT_TIMER;
+                }
+                /*The TOP is fixed. So the prescalar with the nearest period is selected.*/
+                for(uint8_iterator = 0; uint8_iterator < FIND_ARR_LENGTH(global_arr_str_prescalar_info_table); uint8_iterator++)
+                {
+                    uint32_period_ticks = calculate_pwm_period_ticks(enum_timer_mode, uint16_top_value) << global_arr_str_prescalar_info_table[uint8_iterator].uint8_prescalar_shift;
+                    uint32_error_cycles = (uint32_period_ticks > uint32_period_cycles) ? (uint32_period_ticks - uint32_period_cycles) : (uint32_period_cycles - uint32_period_ticks);
+                    if  (
+                            (uint32_error_cycles < uint32_min_error_cycles) &&
+                            ((enum_timer_index == TIMER_INDEX_2) || ((global_arr_str_prescalar_info_table[uint8_iterator].uint8_is_timer_2_only) == FALSE))
+                        )
+                    {
+                        uint32_min_error_cycles = uint32_error_cycles;
+                        uint8_selected_index    = uint8_iterator;
+                    }
+                }
             }
-            else if(enum_timer_index_with_polling == TIMER_INDEX_2)
+
+            if(sint32_retval == SUCCESS_RETVAL)
             {
-                while(GET_BIT(REG_TIFR, TOV2_BIT) == 0);
-                uint32_local_interrupt_counter++;
-                if(uint32_local_interrupt_counter == global_uint32_timer_2_needed_interrupts)
+                /*The clock is stopped while the prescalar and TOP are changed. So no period runs with a mix of the old and the new values.*/
+                uint8_is_timer_enabled = global_arr_str_timer_database[enum_timer_index].uint8_is_timer_enabled_in_db;
+                if(uint8_is_timer_enabled == TRUE)
+                {
+                    timer_disable(enum_timer_index);
+                }
+                global_arr_str_timer_database[enum_timer_index].enum_timer_prescalar_value_in_db = global_arr_str_prescalar_info_table[uint8_selected_index].enum_timer_prescalar_value;
+
+                if(uint8_is_top_in_icr1 == TRUE)
+                {
+                    /*The 16 Bits Registers are accessed through the shared TEMP Register. So the Interrupts are disabled.*/
+                    uint8_sreg = REG_SREG;
+                    CLEAR_BIT(REG_SREG, I_BIT);
+                    uint16_old_top_value = REG_ICR1;
+                    if(uint16_old_top_value != 0)
+                    {
+                        REG_OCR1A = (uint16_type)(((uint32_type)REG_OCR1A * uint16_top_value) / uint16_old_top_value);
+                        REG_OCR1B = (uint16_type)(((uint32_type)REG_OCR1B * uint16_top_value) / uint16_old_top_value);
+                    }
+                    REG_ICR1 = uint16_top_value;
+                    /*A counter above the new TOP would run up to 0xFFFF before it wraps. So it's restarted from BOTTOM.*/
+                    if(REG_TCNT1 > uint16_top_value)
+                    {
+                        REG_TCNT1 = 0;
+                    }
+                    REG_SREG = uint8_sreg;
+                }
+
+                if(uint8_is_timer_enabled == TRUE)
                 {
-                    global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db(TIMER_INDEX_2);
+                    sint32_retval = timer_enable(enum_timer_index);
                 }
+
+                /*f = F_CPU / (prescalar * period ticks). It's rounded to the nearest Hz.*/
+                uint32_period_ticks = calculate_pwm_period_ticks(enum_timer_mode, uint16_top_value) << global_arr_str_prescalar_info_table[uint8_selected_index].uint8_prescalar_shift;
+                pstr_timer_pwm_frequency_info->uint32_achieved_frequency_in_hz  = (F_CPU + (uint32_period_ticks >> 1)) / uint32_period_ticks;
+                pstr_timer_pwm_frequency_info->uint16_top_value                 = uint16_top_value;
+                pstr_timer_pwm_frequency_info->enum_timer_prescalar_value       = global_arr_str_prescalar_info_table[uint8_selected_index].enum_timer_prescalar_value;
             }
-            else
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to register a callback on the Compare Match B of Timer 1.
+ * 				The callback is called from the TIMER1_COMPB ISR each time TCNT1 matches OCR1B. So it can be used as a second event inside the same period.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index. @note: Only TIMER_INDEX_1 is supported.
+ * @param[in] 	pointer_func_timer_callback:	The callback. NULL_PTR disables the Compare Match B Interrupt.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer has no Compare Channel B.
+ */
+sint32_type timer_set_compare_b_callback(enum_timer_index_type enum_timer_index, pointer_func_timer_callback_type pointer_func_timer_callback)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(enum_timer_index < TIMER_INDEX_INVALID)
+    {
+        if(enum_timer_index != TIMER_INDEX_1)
+        {
+            sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        }
+        else if((global_arr_str_timer_database[enum_timer_index].enum_timer_index_in_db) == TIMER_INDEX_INVALID)
+        {
+            /*This means that this timer doesn't have a saved configuration parameters in the database. So it's not initialized previously.*/
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else
+        {
+            /*The Interrupt is disabled while the callback is changed. So the ISR never sees a half written pointer.*/
+            CLEAR_BIT(REG_TIMSK, OCIE1B_BIT);
+            global_pointer_func_timer_1_compare_b_callback = pointer_func_timer_callback;
+            if(pointer_func_timer_callback != NULL_PTR)
             {
+                /*Clear any old Compare Match B Flag by writing 1. So the first call is on a new match.*/
+                REG_TIFR = (1<<OCF1B_BIT);
+                SET_BIT(REG_TIMSK, OCIE1B_BIT);
+                SET_BIT(REG_SREG, I_BIT);
+            }
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
 
+/**
+ * @brief:		Function that is used to register a callback on the Input Capture of Timer 1.
+ * 				The callback is called from the TIMER1_CAPT ISR each time an edge is captured in ICR1. It shall read ICR1 to get the edge time.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index. @note: Only TIMER_INDEX_1 is supported.
+ * @param[in] 	pointer_func_timer_callback:	The callback. NULL_PTR disables the Input Capture Interrupt.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer has no Input Capture Unit or ICR1 is used as TOP. (TIMER_MODE_CTC_ICR)
+ */
+sint32_type timer_set_input_capture_callback(enum_timer_index_type enum_timer_index, pointer_func_timer_callback_type pointer_func_timer_callback)
+{
+    sint32_type sint32_retval = SUCCESS_RETVAL;
+    if(enum_timer_index < TIMER_INDEX_INVALID)
+    {
+        if(enum_timer_index != TIMER_INDEX_1)
+        {
+            sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        }
+        else if((global_arr_str_timer_database[enum_timer_index].enum_timer_index_in_db) == TIMER_INDEX_INVALID)
+        {
+            /*This means that this timer doesn't have a saved configuration parameters in the database. So it's not initialized previously.*/
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else if((global_arr_str_timer_database[enum_timer_index].enum_timer_mode_in_db) == TIMER_MODE_CTC_ICR)
+        {
+            sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+        }
+        else
+        {
+            /*The Interrupt is disabled while the callback is changed. So the ISR never sees a half written pointer.*/
+            CLEAR_BIT(REG_TIMSK, TICIE1_BIT);
+            global_pointer_func_timer_1_input_capture_callback = pointer_func_timer_callback;
+            if(pointer_func_timer_callback != NULL_PTR)
+            {
+                /*Clear any old Input Capture Flag by writing 1. So the first call is on a new edge.*/
+                REG_TIFR = (1<<ICF1_BIT);
+                SET_BIT(REG_TIMSK, TICIE1_BIT);
+                SET_BIT(REG_SREG, I_BIT);
             }
         }
-        else if(global_arr_str_timer_database[enum_timer_index_with_polling].enum_timer_mode_in_db == TIMER_MODE_CTC)
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to get the delay that is actually programmed by the last call to @fn: timer_delay.
+ * 				The requested delay is rounded to the Timer Ticks of the configured prescalar. (And to equal segments in TIMER_MODE_CTC)
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index.
+ * @param[out] 	puint32_achieved_delay_in_us:	Address of a variable in which the achieved delay in Micro Seconds will be stored. It saturates at 0xFFFFFFFF (About 71 Minutes).
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ */
+sint32_type timer_get_achieved_delay(enum_timer_index_type enum_timer_index, uint32_type* puint32_achieved_delay_in_us)
+{
+    sint32_type                             sint32_retval       = SUCCESS_RETVAL;
+    const struct_timer_prescalar_info_type* pstr_prescalar_info = NULL_PTR;
+    uint32_type                             uint32_ticks        = 0;
+    uint32_type                             uint32_cycles       = 0;
+    uint32_type                             uint32_delay_in_ms  = 0;
+    if((enum_timer_index < TIMER_INDEX_INVALID) && (puint32_achieved_delay_in_us != NULL_PTR))
+    {
+        pstr_prescalar_info = find_prescalar_info(global_arr_str_timer_database[enum_timer_index].enum_timer_prescalar_value_in_db);
+        if(((global_arr_str_timer_database[enum_timer_index].enum_timer_index_in_db) == TIMER_INDEX_INVALID) || (pstr_prescalar_info == NULL_PTR))
         {
-            if(enum_timer_index_with_polling == TIMER_INDEX_0)
+            /*This means that this timer doesn't have a saved configuration parameters in the database. So it's not initialized previously.*/
+            sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+        }
+        else
+        {
+            /*  us = ticks * 2^shift * 1000 / F_KHZ. It's divided by F_KHZ first on two steps.
+                So each remainder is less than F_KHZ and no product overflows 32 Bits.*/
+            uint32_ticks        = global_arr_str_timer_database[enum_timer_index].uint32_achieved_delay_ticks_in_db;
+            uint32_cycles       = (uint32_ticks % F_KHZ) << pstr_prescalar_info->uint8_prescalar_shift;
+            uint32_delay_in_ms  = ((uint32_ticks / F_KHZ) << pstr_prescalar_info->uint8_prescalar_shift) + (uint32_cycles / F_KHZ);
+            if(uint32_delay_in_ms > (MAX_DELAY_IN_US / CONVERT_FROM_MILLI_TO_MICRO))
             {
-                while(GET_BIT(REG_TIFR, OCF0_BIT) == 0);
-                uint32_local_interrupt_counter++;
-                if(uint32_local_interrupt_counter == global_uint32_timer_2_needed_interrupts)
-                {
-                    global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db(TIMER_INDEX_2);
-                }
+                *puint32_achieved_delay_in_us = MAX_DELAY_IN_US;
             }
-            else if(enum_timer_index_with_polling == TIMER_INDEX_1)
+            else
             {
-
+                *puint32_achieved_delay_in_us = (uint32_delay_in_ms * CONVERT_FROM_MILLI_TO_MICRO) + (((uint32_cycles % F_KHZ) * CONVERT_FROM_MILLI_TO_MICRO) / F_KHZ);
             }
-            else if(enum_timer_index_with_polling == TIMER_INDEX_2)
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to read the statistics of the deferred callbacks queue.
+ * 
+ * @param[out] 	pstr_timer_event_queue_statistics:	Address of a structure in which the statistics will be stored.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type timer_get_event_queue_statistics(tstr_timer_event_queue_statistics* pstr_timer_event_queue_statistics)
+{
+    sint32_type sint32_retval   = SUCCESS_RETVAL;
+    uint8_type  uint8_sreg      = 0;
+    if(pstr_timer_event_queue_statistics != NULL_PTR)
+    {
+        /*The 16 Bits counter is written by the ISR(s). So the Interrupts are disabled while it's read.*/
+        uint8_sreg = REG_SREG;
+        CLEAR_BIT(REG_SREG, I_BIT);
+        pstr_timer_event_queue_statistics->uint8_current_depth              = (uint8_type)((global_uint8_timer_event_queue_tail - global_uint8_timer_event_queue_head) & TIMER_EVENT_QUEUE_MASK);
+        pstr_timer_event_queue_statistics->uint8_max_depth                  = global_uint8_timer_event_queue_max_depth;
+        pstr_timer_event_queue_statistics->uint16_number_of_dropped_events  = global_uint16_timer_dropped_events;
+        REG_SREG = uint8_sreg;
+    }
+    else
+    {
+        sint32_retval = ERROR_INVALID_ARGUMENTS;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:		Function that is used to Handle all the timer events in the main loop.
+ * 				It calls the callbacks of the events queued by the timers with TIMER_USAGE_DEFERRED in the order they were raised.
+ * 				Then it checks the period flag of the timer with TIMER_USAGE_POLLING.
+ * @note:		It shall be called periodically. The events are dropped when the queue is full.
+ * @return 		None
+ */
+void timer_dispatcher(void)
+{
+    uint8_type                          uint8_head                  = global_uint8_timer_event_queue_head;
+    uint8_type                          uint8_flag_bit              = 0;
+    enum_timer_index_type               enum_timer_index            = TIMER_INDEX_INVALID;
+    pointer_func_timer_callback_type    pointer_func_timer_callback = NULL_PTR;
+
+    /*Only the events queued before the call are handled. So a callback that is faster than its timer can't keep the dispatcher busy forever.*/
+    uint8_type                          uint8_tail                  = global_uint8_timer_event_queue_tail;
+    while(uint8_head != uint8_tail)
+    {
+        enum_timer_index                    = (enum_timer_index_type)global_arr_uint8_timer_event_queue[uint8_head];
+        uint8_head                          = (uint8_type)((uint8_head + 1) & TIMER_EVENT_QUEUE_MASK);
+        /*The entry is released before the callback. So the ISR(s) can queue new events while it runs.*/
+        global_uint8_timer_event_queue_head = uint8_head;
+        pointer_func_timer_callback         = global_arr_str_timer_database[enum_timer_index].pointer_func_timer_callback_in_db;
+        if(pointer_func_timer_callback != NULL_PTR)
+        {
+            pointer_func_timer_callback(enum_timer_index);
+        }
+    }
+
+    /*The Interrupt of the polling timer is disabled. So its flag is cleared here by writing 1 and its countdown is handled like in the ISR.*/
+    enum_timer_index = global_enum_timer_index_with_polling;
+    if(enum_timer_index != TIMER_INDEX_INVALID)
+    {
+        uint8_flag_bit = get_timer_period_flag_bit(enum_timer_index);
+        if(GET_BIT(REG_TIFR, uint8_flag_bit) != 0)
+        {
+            REG_TIFR = (uint8_type)(1<<uint8_flag_bit);
+            global_arr_uint16_timer_countdown[enum_timer_index]--;
+            if(global_arr_uint16_timer_countdown[enum_timer_index] == 0)
             {
-                while(GET_BIT(REG_TIFR, OCF2_BIT) == 0);
-                uint32_local_interrupt_counter++;
-                if(uint32_local_interrupt_counter == global_uint32_timer_2_needed_interrupts)
+                global_arr_uint16_timer_countdown[enum_timer_index] = global_arr_uint16_timer_reload[enum_timer_index];
+                if(global_arr_str_timer_database[enum_timer_index].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
+                {
+                    load_timer_segment(enum_timer_index, TRUE);
+                }
+                else if(global_arr_str_timer_database[enum_timer_index].enum_timer_delay_mode_in_db == TIMER_DELAY_ONE_SHOT)
+                {
+                    stop_expired_timer(enum_timer_index);
+                }
+                if(global_arr_str_timer_database[enum_timer_index].pointer_func_timer_callback_in_db != NULL_PTR)
                 {
-                    global_arr_str_timer_database[TIMER_INDEX_2].pointer_func_timer_callback_in_db(TIMER_INDEX_2);
+                    global_arr_str_timer_database[enum_timer_index].pointer_func_timer_callback_in_db(enum_timer_index);
                 }
             }
-            else
+            else if(global_arr_str_timer_database[enum_timer_index].enum_timer_delay_mode_in_db == TIMER_DELAY_PERIODIC)
             {
-
+                load_timer_segment(enum_timer_index, FALSE);
             }
         }
     }
 }
-#endif
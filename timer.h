@@ -9,6 +9,11 @@
 
 #include "types.h"
 
+/*Number of entries of the deferred callbacks queue. It shall be a power of 2 up to 128. One entry is kept empty to tell the full queue from the empty one.*/
+#ifndef TIMER_EVENT_QUEUE_SIZE
+#define TIMER_EVENT_QUEUE_SIZE	8
+#endif
+
 /**
  * 
  * @enum: 	enum_timer_index_type
@@ -28,12 +33,15 @@ typedef enum
  * 
  * @enum: 	enum_timer_interrupt_usage_type
  * @brief: 	Enumeration that Illustrates each timer interrupt status
+ * @note:	TIMER_USAGE_POLLING and TIMER_USAGE_DEFERRED call the callback from @fn: timer_dispatcher in the main loop.
+ * 			TIMER_USAGE_DEFERRED keeps the interrupt. The ISR queues an event only. So a slow callback (Ex: LCD output) doesn't block the other interrupts.
  * 
  */
 typedef enum
 {
 	TIMER_USAGE_INTERRUPT = 0,
 	TIMER_USAGE_POLLING,
+	TIMER_USAGE_DEFERRED,
 	TIMER_USAGE_INVALID
 }enum_timer_interrupt_usage_type;
 
@@ -41,6 +49,8 @@ typedef enum
  * 
  * @enum: 	enum_timer_mode_type
  * @brief: 	Enumeration that Indicates each timer mode of operation.
+ * @note:	For Timer 1: TIMER_MODE_CTC uses OCR1A as TOP. The TOP of TIMER_MODE_PWM and TIMER_MODE_PHASE_PWM is selected by @ref: enum_timer_pwm_resolution_type
+ * 			TIMER_MODE_CTC_ICR and TIMER_MODE_PHASE_FREQ_PWM use ICR1 as TOP. They are supported by Timer 1 only.
  * 
  */
 typedef enum
@@ -49,23 +59,84 @@ typedef enum
 	TIMER_MODE_CTC,
 	TIMER_MODE_PWM,
 	TIMER_MODE_PHASE_PWM,
+	TIMER_MODE_CTC_ICR,
+	TIMER_MODE_PHASE_FREQ_PWM,
 	TIMER_MODE_INVALID
 }enum_timer_mode_type;
 
 /**
  * @enum:	enum_timer_prescalar_value_type
  * @brief:	Enumeration Describe the supported values of Prescalar for internal clock usage.
+ * @note:	TIMER_32_PRESCALAR and TIMER_128_PRESCALAR are supported by Timer 2 only.
  * 
  */
 typedef enum
 {
 	TIMER_NO_PRESCALAR		= 1,
 	TIMER_8_PRESCALAR		= 8,
+	TIMER_32_PRESCALAR		= 32,
 	TIMER_64_PRESCALAR		= 64,
+	TIMER_128_PRESCALAR		= 128,
 	TIMER_256_PRESCALAR		= 256,
 	TIMER_1024_PRESCALAR	= 1024,
 	TIMER_INVALID_PRESCALAR
 }enum_timer_prescalar_value_type;
+/**
+ * @enum:	enum_timer_pwm_resolution_type
+ * @brief:	Enumeration of the PWM Resolutions in TIMER_MODE_PWM and TIMER_MODE_PHASE_PWM. Timer 0 and Timer 2 support TIMER_PWM_RESOLUTION_8_BITS only.
+ * @note:	TIMER_PWM_RESOLUTION_16_BITS uses ICR1 as TOP. It's set to 0xFFFF by @fn: timer_init and can be changed by @fn: timer_set_top_value
+ * 
+ */
+typedef enum
+{
+	TIMER_PWM_RESOLUTION_8_BITS = 0,
+	TIMER_PWM_RESOLUTION_9_BITS,
+	TIMER_PWM_RESOLUTION_10_BITS,
+	TIMER_PWM_RESOLUTION_16_BITS,
+	TIMER_PWM_RESOLUTION_INVALID
+}enum_timer_pwm_resolution_type;
+
+/**
+ * @enum:	enum_timer_clock_source_type
+ * @brief:	Enumeration of the Timer Clock Sources. TIMER_CLOCK_SOURCE_ASYNC_CRYSTAL is supported by Timer 2 only.
+ * 			It clocks Timer 2 from a 32.768 KHz Watch Crystal on the TOSC1 and TOSC2 Pins (PC6, PC7). So Timer 2 keeps running in the Power Save Sleep.
+ * @note:	The delays and the PWM frequencies are calculated from F_CPU. So @fn: timer_delay and @fn: timer_set_pwm_frequency don't support the crystal.
+ * 
+ */
+typedef enum
+{
+	TIMER_CLOCK_SOURCE_CPU = 0,
+	TIMER_CLOCK_SOURCE_ASYNC_CRYSTAL,
+	TIMER_CLOCK_SOURCE_INVALID
+}enum_timer_clock_source_type;
+
+/**
+ * @enum:	enum_timer_delay_mode_type
+ * @brief:	Enumeration of the modes of @fn: timer_delay.
+ * 			TIMER_DELAY_ONE_SHOT:	The clock of the timer is stopped by the ISR on expiry. Then the callback is called once.
+ * 			TIMER_DELAY_PERIODIC:	The callback is called on each period. The fraction of a Tick that can't be programmed is carried to the next periods.
+ * 									So the average period is exact and the timer doesn't drift. @note: It's supported in TIMER_MODE_CTC and TIMER_MODE_CTC_ICR only.
+ * 
+ */
+typedef enum
+{
+	TIMER_DELAY_ONE_SHOT = 0,
+	TIMER_DELAY_PERIODIC,
+	TIMER_DELAY_INVALID
+}enum_timer_delay_mode_type;
+
+/**
+ * @enum:	enum_timer_compare_channel_type
+ * @brief:	Enumeration of the Output Compare Channels. Timer 0 and Timer 2 have channel A only (OCR0, OCR2). Timer 1 has OCR1A and OCR1B.
+ * 
+ */
+typedef enum
+{
+	TIMER_COMPARE_CHANNEL_A	= 0,
+	TIMER_COMPARE_CHANNEL_B,
+	TIMER_COMPARE_CHANNEL_INVALID
+}enum_timer_compare_channel_type;
+
 /**
  * 
  * @typedef: 	pointer_func_timer_callback_type
@@ -88,8 +159,36 @@ typedef struct
 	enum_timer_mode_type				enum_timer_mode;
 	enum_timer_prescalar_value_type		enum_timer_prescalar_value;
 	pointer_func_timer_callback_type	pointer_func_timer_callback;
+	enum_timer_pwm_resolution_type		enum_timer_pwm_resolution;		/*Used in the PWM modes only. The default value (0) is TIMER_PWM_RESOLUTION_8_BITS*/
+	enum_timer_clock_source_type		enum_timer_clock_source;		/*The default value (0) is TIMER_CLOCK_SOURCE_CPU*/
 }tstr_timer_config;
 
+/**
+ * 
+ * @struct: 	tstr_timer_pwm_frequency_info
+ * @brief: 		Structure that contains the PWM Frequency achieved by @fn: timer_set_pwm_frequency
+ * 
+ */
+typedef struct
+{
+	uint32_type							uint32_achieved_frequency_in_hz;
+	uint16_type							uint16_top_value;				/*The Duty Cycle has (TOP + 1) steps.*/
+	enum_timer_prescalar_value_type		enum_timer_prescalar_value;
+}tstr_timer_pwm_frequency_info;
+
+/**
+ * 
+ * @struct: 	tstr_timer_event_queue_statistics
+ * @brief: 		Structure that contains the statistics of the deferred callbacks queue.
+ * 
+ */
+typedef struct
+{
+	uint8_type							uint8_current_depth;
+	uint8_type							uint8_max_depth;				/*The highest depth since the start. It shows how close the queue was to be full.*/
+	uint16_type							uint16_number_of_dropped_events;	/*The events raised while the queue is full. It saturates at 0xFFFF.*/
+}tstr_timer_event_queue_statistics;
+
 /**
  * @brief: 		Function that is used to initialize each timer.
  * 
@@ -133,35 +232,147 @@ sint32_type timer_enable(enum_timer_index_type enum_timer_index);
 sint32_type timer_disable(enum_timer_index_type enum_timer_index);
 
 /**
- * @brief:		Function that is used to set a specific delay value for a specific timer index.
- * @note:		The Delay will be done here is a single shot. 
- * 				This means that this delay will be done for one time only. After the timer finishes the delay value, it will execute the timer callback.
+ * @brief:		Function that is used to set a specific delay value for a specific timer index and start the timer.
+ * @note:		TIMER_DELAY_ONE_SHOT: The delay will be done for one time only. The timer is stopped on expiry. Then it will execute the timer callback.
+ * 				TIMER_DELAY_PERIODIC: The timer keeps running and executes the timer callback on each period until @fn: timer_disable is called.
  * 
  * @param[in] 	enum_timer_index: 	Enumeration for the specific timer index the user wants to delay.
  * @param[in] 	uint32_delay_in_ms: The specific delay value in Milli Seconds.
+ * @param[in] 	enum_timer_delay_mode: One Shot or Periodic.
  * @return 		SUCCESS_RETVAL: In case of success. 
  *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
  * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer is running or its mode doesn't support the delay mode. (Ex: TIMER_DELAY_PERIODIC in TIMER_MODE_OVF)
+ * 				ERROR_OUT_OF_BOUNDARY: In case that the delay needs more than 2^32 Timer Ticks or more than 65535 interrupts with the configured prescalar.
  */
-sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint32_delay_in_ms);
+sint32_type timer_delay(enum_timer_index_type enum_timer_index, uint32_type uint32_delay_in_ms, enum_timer_delay_mode_type enum_timer_delay_mode);
 
 /**
- * @brief:		Function that is used to generate a PWM (Pulse Width Modulation) for the timer
+ * @brief:		Function that is used to generate a PWM (Pulse Width Modulation) on the Compare Channel A of the timer. (OC0, OC1A or OC2 Pin)
  * 
  * @param[in] 	enum_timer_index: 	Enumeration for the specific timer index the user wants to generate a PWM on it. 
- * @param[in] 	uint8_duty_cycle:	Timer Duty Cycle the user wants to generate on the timer. 
+ * @param[in] 	uint8_duty_cycle:	Timer Duty Cycle in percent the user wants to generate on the timer. From 0 to 100.
  * @return 		SUCCESS_RETVAL: In case of success. 
  *  			ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
- * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer was not configured in the @fn: timer_init in the @member: enum_timer_mode_type in the @struct: tstr_timer_config was not equal to TIMER_MODE_PWM | TIMER_MODE_PHASE_PWM
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer was not configured in the @fn: timer_init in the @member: enum_timer_mode_type in the @struct: tstr_timer_config was not equal to TIMER_MODE_PWM | TIMER_MODE_PHASE_PWM | TIMER_MODE_PHASE_FREQ_PWM
  */
 sint32_type	timer_generate_pwm(enum_timer_index_type enum_timer_index, uint8_type uint8_duty_cycle);
 
-#if (0)
 /**
- * @brief:		Function that is used to Handle all the timer events in the main loop
+ * @brief:		Function that is used to generate a PWM (Pulse Width Modulation) on a specific Compare Channel of the timer.
+ * 				The waveform is driven on the Output Compare Pin by the hardware. So no interrupt is needed to generate it.
+ * 				It can be called while the timer runs to change the Duty Cycle. The new value is applied at the end of the current period without glitches.
+ * 
+ * @param[in] 	enum_timer_index: 			Enumeration for the specific timer index the user wants to generate a PWM on it. 
+ * @param[in] 	enum_timer_compare_channel:	The Output Compare Channel. @note: Timer 0 and Timer 2 support TIMER_COMPARE_CHANNEL_A only.
+ * @param[in] 	uint8_duty_cycle:			Timer Duty Cycle in percent the user wants to generate on the timer. From 0 to 100.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ *  			ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer is not configured in a PWM mode or the channel is not supported by this timer.
+ */
+sint32_type	timer_generate_pwm_on_channel(enum_timer_index_type enum_timer_index, enum_timer_compare_channel_type enum_timer_compare_channel, uint8_type uint8_duty_cycle);
+
+/**
+ * @brief:		Function that is used to write the Output Compare Register of a specific timer channel directly in Timer Ticks.
+ * 				This can be used to set the period of a timer in TIMER_MODE_CTC (Ex: As an ADC Auto Trigger Source).
+ * 
+ * @param[in] 	enum_timer_index: 			Enumeration for the specific timer index.
+ * @param[in] 	enum_timer_compare_channel:	The Output Compare Channel. @note: Timer 0 and Timer 2 support TIMER_COMPARE_CHANNEL_A only.
+ * @param[in] 	uint16_compare_value:		The Compare Value. @note: This shall not exceed 255 for Timer 0 and Timer 2.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ */
+sint32_type timer_set_compare_value(enum_timer_index_type enum_timer_index, enum_timer_compare_channel_type enum_timer_compare_channel, uint16_type uint16_compare_value);
+
+/**
+ * @brief:		Function that is used to write the TOP value (ICR1) of Timer 1 in the modes that use ICR1 as TOP.
+ * 				This sets the period to (TOP + 1) Ticks in TIMER_MODE_CTC_ICR and to 2 * TOP Ticks in TIMER_MODE_PHASE_FREQ_PWM.
+ * 
+ * @param[in] 	enum_timer_index: 		Enumeration for the specific timer index. @note: Only TIMER_INDEX_1 is supported.
+ * @param[in] 	uint16_top_value:		The TOP Value.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer has no ICR1 Register.
+ */
+sint32_type timer_set_top_value(enum_timer_index_type enum_timer_index, uint16_type uint16_top_value);
+
+/**
+ * @brief:		Function that is used to select the prescalar and the TOP of a timer in a PWM mode from a target PWM Frequency.
+ * 				Timer 1 with TIMER_PWM_RESOLUTION_16_BITS or in TIMER_MODE_PHASE_FREQ_PWM uses ICR1 as TOP. So the smallest prescalar that fits the period in 16 Bits is selected to get the finest Duty Cycle.
+ * 				(Ex: 20 KHz Fast PWM @ 16 MHz: No Prescalar and TOP = 799. So the Duty Cycle has 800 steps)
+ * 				The other modes have a fixed TOP. So only the prescalar is selected and the nearest period is taken.
+ * 				The Phase Correct modes count up and down. So their period is 2 * TOP Ticks instead of (TOP + 1) Ticks.
+ * @note:		The Compare Values are rescaled to the new TOP. So the Duty Cycles are kept.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index.
+ * @param[in] 	uint32_frequency_in_hz:			The target PWM Frequency in Hz.
+ * @param[out] 	pstr_timer_pwm_frequency_info:	Address of a structure in which the achieved frequency, TOP and prescalar will be stored.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that this timer is not configured in a PWM mode.
+ * 				ERROR_OUT_OF_BOUNDARY: In case that the frequency can't be reached with ICR1 as TOP. (TOP shall be from 3 to 0xFFFF)
+ */
+sint32_type timer_set_pwm_frequency(enum_timer_index_type enum_timer_index, uint32_type uint32_frequency_in_hz, tstr_timer_pwm_frequency_info* pstr_timer_pwm_frequency_info);
+
+/**
+ * @brief:		Function that is used to register a callback on the Compare Match B of Timer 1.
+ * 				The callback is called from the TIMER1_COMPB ISR each time TCNT1 matches OCR1B. So it can be used as a second event inside the same period.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index. @note: Only TIMER_INDEX_1 is supported.
+ * @param[in] 	pointer_func_timer_callback:	The callback. NULL_PTR disables the Compare Match B Interrupt.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer has no Compare Channel B.
+ */
+sint32_type timer_set_compare_b_callback(enum_timer_index_type enum_timer_index, pointer_func_timer_callback_type pointer_func_timer_callback);
+
+/**
+ * @brief:		Function that is used to register a callback on the Input Capture of Timer 1.
+ * 				The callback is called from the TIMER1_CAPT ISR each time an edge is captured in ICR1. It shall read ICR1 to get the edge time.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index. @note: Only TIMER_INDEX_1 is supported.
+ * @param[in] 	pointer_func_timer_callback:	The callback. NULL_PTR disables the Input Capture Interrupt.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ * 				ERROR_UNSUPPORTED_FEATURE: In case that the timer has no Input Capture Unit or ICR1 is used as TOP. (TIMER_MODE_CTC_ICR)
+ */
+sint32_type timer_set_input_capture_callback(enum_timer_index_type enum_timer_index, pointer_func_timer_callback_type pointer_func_timer_callback);
+
+/**
+ * @brief:		Function that is used to get the delay that is actually programmed by the last call to @fn: timer_delay.
+ * 				The requested delay is rounded to the Timer Ticks of the configured prescalar. (And to equal segments in TIMER_MODE_CTC)
+ * 				In TIMER_DELAY_PERIODIC it's the short period. The average period is the requested delay.
+ * 
+ * @param[in] 	enum_timer_index: 				Enumeration for the specific timer index.
+ * @param[out] 	puint32_achieved_delay_in_us:	Address of a variable in which the achieved delay in Micro Seconds will be stored. It saturates at 0xFFFFFFFF (About 71 Minutes).
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ * 				ERROR_MODULE_NOT_INITAILIZED: In case that this timer is not configured yet. Ie, the initialization is not done yet for this specific index. 
+ */
+sint32_type timer_get_achieved_delay(enum_timer_index_type enum_timer_index, uint32_type* puint32_achieved_delay_in_us);
+
+/**
+ * @brief:		Function that is used to read the statistics of the deferred callbacks queue.
+ * 
+ * @param[out] 	pstr_timer_event_queue_statistics:	Address of a structure in which the statistics will be stored.
+ * @return 		SUCCESS_RETVAL: In case of success. 
+ *  			ERROR_INVALID_ARGUMENTS: In case of Invalid Arguments Passed to the function.
+ */
+sint32_type timer_get_event_queue_statistics(tstr_timer_event_queue_statistics* pstr_timer_event_queue_statistics);
+
+/**
+ * @brief:		Function that is used to Handle all the timer events in the main loop.
+ * 				It calls the callbacks of the events queued by the timers with TIMER_USAGE_DEFERRED in the order they were raised.
+ * 				Then it checks the period flag of the timer with TIMER_USAGE_POLLING.
+ * @note:		It shall be called periodically. The events are dropped when the queue is full.
  * @return 		None
  */
 void timer_dispatcher(void);
-#endif
 
 #endif 	/*__TIMERS_H__*/
@@ -0,0 +1,134 @@
+/**
+ * @file:       timestamp.c
+ * @author:     Mina Raouf
+ * @brief:      File Contains the implementation of the Monotonic Time Base on Timer 1.
+ * @version:    1.0
+ * @date:       2022-08-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "timestamp.h"
+#include "timer.h"
+#include "errors.h"
+#include "atmega32a_register_file.h"
+#include "bit_manipulation.h"
+
+#define TOV1_BIT                        2   /*Bit Index inside the REG_TIFR*/
+#define I_BIT                           7   /*Bit Index inside the REG_SREG*/
+
+/*A counter value in the lower half means that it has wrapped after the pending overflow.*/
+#define TIMESTAMP_HALF_COUNTER_VALUE    0x8000
+
+static volatile uint32_type guint32_number_of_overflows = 0;
+
+static void timestamp_overflow_callback(enum_timer_index_type enum_timer_index);
+static void read_time_base(uint32_type* puint32_number_of_overflows, uint16_type* puint16_counter_value);
+
+/**
+ * @brief:  Timer 1 Overflow callback. It counts the upper Bits of the time.
+ * @return  None
+ */
+static void timestamp_overflow_callback(enum_timer_index_type enum_timer_index)
+{
+    (void)enum_timer_index;
+    guint32_number_of_overflows++;
+}
+
+/**
+ * @brief:  Function that is used to read the overflow counter and the live counter as one consistent value.
+ * @return  None
+ */
+static void read_time_base(uint32_type* puint32_number_of_overflows, uint16_type* puint16_counter_value)
+{
+    uint8_type  uint8_sreg = REG_SREG;
+
+    CLEAR_BIT(REG_SREG, I_BIT);
+    *puint16_counter_value       = REG_TCNT1;
+    *puint32_number_of_overflows = guint32_number_of_overflows;
+    /*  The counter may wrap after the interrupts are disabled. Then the overflow flag is pending and the counter is small.
+        The counter is read before the flag. So a flag raised after the read belongs to a large counter value and is not counted.*/
+    if((GET_BIT(REG_TIFR, TOV1_BIT) != 0) && (*puint16_counter_value < TIMESTAMP_HALF_COUNTER_VALUE))
+    {
+        (*puint32_number_of_overflows)++;
+    }
+    REG_SREG = uint8_sreg;
+}
+
+/**
+ * @brief:      Function that is used to initialize Timer 1 as a free running Time Base and start it.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              Or any error returned by @fn: timer_init on Timer 1. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 1 is used by another module)
+ */
+sint32_type timestamp_init(void)
+{
+    sint32_type         sint32_retval = SUCCESS_RETVAL;
+    tstr_timer_config   str_timer_config;
+
+    str_timer_config.enum_timer_index               = TIMER_INDEX_1;
+    str_timer_config.enum_timer_interrupt_usage     = TIMER_USAGE_INTERRUPT;
+    str_timer_config.enum_timer_mode                = TIMER_MODE_OVF;
+    str_timer_config.enum_timer_prescalar_value     = (enum_timer_prescalar_value_type)TIMESTAMP_PRESCALAR;
+    str_timer_config.pointer_func_timer_callback    = timestamp_overflow_callback;
+    str_timer_config.enum_timer_pwm_resolution      = TIMER_PWM_RESOLUTION_8_BITS;
+    str_timer_config.enum_timer_clock_source        = TIMER_CLOCK_SOURCE_CPU;
+    sint32_retval = timer_init(&str_timer_config);
+    if(sint32_retval == SUCCESS_RETVAL)
+    {
+        guint32_number_of_overflows = 0;
+        REG_TCNT1                   = 0;
+        sint32_retval               = timer_enable(TIMER_INDEX_1);
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to read the Time Base in Timer Ticks. It wraps around after 2^32 Ticks.
+ *              So the elapsed time shall be computed as the unsigned difference of two reads.
+ * @note:       It can be called from the ISR(s). The Interrupts are disabled for a few cycles only.
+ *
+ * @return      The Time in Timer Ticks. (1 / TIMESTAMP_TICKS_PER_US Micro Second each)
+ */
+uint32_type time_now_ticks(void)
+{
+    uint32_type uint32_number_of_overflows  = 0;
+    uint16_type uint16_counter_value        = 0;
+    read_time_base(&uint32_number_of_overflows, &uint16_counter_value);
+    return (uint32_number_of_overflows << 16) | uint16_counter_value;
+}
+
+/**
+ * @brief:      Function that is used to read the Time Base in Micro Seconds. It wraps around after 2^32 Micro Seconds. (About 71 Minutes)
+ * @note:       It can be called from the ISR(s). The Interrupts are disabled for a few cycles only.
+ *
+ * @return      The Time in Micro Seconds.
+ */
+uint32_type time_now_us(void)
+{
+    uint32_type uint32_number_of_overflows  = 0;
+    uint16_type uint16_counter_value        = 0;
+    read_time_base(&uint32_number_of_overflows, &uint16_counter_value);
+    /*Each overflow is 2^(16 - shift) Micro Seconds. So the result wraps at 2^32 Micro Seconds like the ticks wrap at 2^32 Ticks.*/
+    return (uint32_number_of_overflows << (16 - TIMESTAMP_TICKS_PER_US_SHIFT)) + TIMESTAMP_TICKS_TO_US(uint16_counter_value);
+}
+
+/**
+ * @brief:      Function that is used to extend a 16 Bits Timer 1 value latched by the hardware (Ex: ICR1) to the 32 Bits Time Base.
+ *              The value shall be latched within half a Timer 1 period before the call. (32.7 ms with 2 Ticks per Micro Second)
+ * @note:       It shall be called with the interrupts disabled. (Ex: From the TIMER1_CAPT ISR)
+ *
+ * @param[in]   uint16_latched_ticks:   The latched value of TCNT1.
+ * @return      The latched time in Timer Ticks on the same scale as @ref: time_now_ticks
+ */
+uint32_type time_extend_ticks(uint16_type uint16_latched_ticks)
+{
+    uint32_type uint32_number_of_overflows = guint32_number_of_overflows;
+    /*A pending overflow with a small latched value means that the value was latched after the counter wrapped.*/
+    if((GET_BIT(REG_TIFR, TOV1_BIT) != 0) && (uint16_latched_ticks < TIMESTAMP_HALF_COUNTER_VALUE))
+    {
+        uint32_number_of_overflows++;
+    }
+    return (uint32_number_of_overflows << 16) | uint16_latched_ticks;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file:           timestamp.h
+ * @author:         Mina Raouf
+ * @brief:          This file contains the API(s) Declaration of the Monotonic Time Base.
+ *                  Timer 1 runs freely in TIMER_MODE_OVF and its 16 Bits counter is extended by a software overflow counter.
+ * @note:           Timer 1 is owned by this module after @ref: timestamp_init. It shall not be used for delays or PWM.
+ *                  The Input Capture Unit can still be used as it doesn't change the counting.
+ */
+
+#ifndef __TIMESTAMP_H__
+#define __TIMESTAMP_H__
+
+#include "types.h"
+
+#ifndef F_CPU
+#define F_CPU                               16000000UL
+#endif
+
+/*Timer 1 Prescalar of the Time Base. F_CPU / TIMESTAMP_PRESCALAR shall be 1, 2, 4, 8 or 16 MHz. So the conversion to Micro Seconds is a shift.*/
+#ifndef TIMESTAMP_PRESCALAR
+#define TIMESTAMP_PRESCALAR                 8
+#endif
+
+#define TIMESTAMP_TICKS_PER_US              ((F_CPU / TIMESTAMP_PRESCALAR) / 1000000UL)
+
+#if (((F_CPU / TIMESTAMP_PRESCALAR) % 1000000UL) != 0)
+#error "F_CPU / TIMESTAMP_PRESCALAR shall be a whole number of MHz"
+#endif
+
+#if     (TIMESTAMP_TICKS_PER_US == 1)
+#define TIMESTAMP_TICKS_PER_US_SHIFT        0
+#elif   (TIMESTAMP_TICKS_PER_US == 2)
+#define TIMESTAMP_TICKS_PER_US_SHIFT        1
+#elif   (TIMESTAMP_TICKS_PER_US == 4)
+#define TIMESTAMP_TICKS_PER_US_SHIFT        2
+#elif   (TIMESTAMP_TICKS_PER_US == 8)
+#define TIMESTAMP_TICKS_PER_US_SHIFT        3
+#elif   (TIMESTAMP_TICKS_PER_US == 16)
+#define TIMESTAMP_TICKS_PER_US_SHIFT        4
+#else
+#error "F_CPU / TIMESTAMP_PRESCALAR shall be 1, 2, 4, 8 or 16 MHz"
+#endif
+
+/*Converts a difference of two @ref: time_now_ticks values to Micro Seconds.*/
+#define TIMESTAMP_TICKS_TO_US(TICKS)        ((TICKS) >> TIMESTAMP_TICKS_PER_US_SHIFT)
+
+/**
+ * @brief:      Function that is used to initialize Timer 1 as a free running Time Base and start it.
+ *
+ * @return      SUCCESS_RETVAL: In case of success.
+ *              Or any error returned by @fn: timer_init on Timer 1. (Ex: ERROR_MODULE_ALREADY_INITAILIZED in case that Timer 1 is used by another module)
+ */
+sint32_type timestamp_init(void);
+
+/**
+ * @brief:      Function that is used to read the Time Base in Timer Ticks. It wraps around after 2^32 Ticks.
+ *              So the elapsed time shall be computed as the unsigned difference of two reads.
+ * @note:       It can be called from the ISR(s). The Interrupts are disabled for a few cycles only.
+ *
+ * @return      The Time in Timer Ticks. (1 / TIMESTAMP_TICKS_PER_US Micro Second each)
+ */
+uint32_type time_now_ticks(void);
+
+/**
+ * @brief:      Function that is used to read the Time Base in Micro Seconds. It wraps around after 2^32 Micro Seconds. (About 71 Minutes)
+ * @note:       It can be called from the ISR(s). The Interrupts are disabled for a few cycles only.
+ *
+ * @return      The Time in Micro Seconds.
+ */
+uint32_type time_now_us(void);
+
+/**
+ * @brief:      Function that is used to extend a 16 Bits Timer 1 value latched by the hardware (Ex: ICR1) to the 32 Bits Time Base.
+ *              The value shall be latched within half a Timer 1 period before the call. (32.7 ms with 2 Ticks per Micro Second)
+ * @note:       It shall be called with the interrupts disabled. (Ex: From the TIMER1_CAPT ISR)
+ *
+ * @param[in]   uint16_latched_ticks:   The latched value of TCNT1.
+ * @return      The latched time in Timer Ticks on the same scale as @ref: time_now_ticks
+ */
+uint32_type time_extend_ticks(uint16_type uint16_latched_ticks);
+
+#endif  /*__TIMESTAMP_H__*/
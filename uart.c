@@ -13,8 +13,13 @@
 #include "errors.h"
 #include "atmega32a_register_file.h"
 #include "bit_manipulation.h"
+#include "gpio.h"
 #include <avr/interrupt.h>
 
+#ifndef F_CPU
+#define F_CPU                                       16000000UL
+#endif
+
 #define BAUD_2400_FOR_16_MHZ_NORMAL_SPEED           416
 #define BAUD_4800_FOR_16_MHZ_NORMAL_SPEED           207
 #define BAUD_9600_FOR_16_MHZ_NORMAL_SPEED           103
@@ -59,6 +64,7 @@
 #define REG_UCSRB_UCSZ2_BIT                                   2
 
 /*Register UCSRC Bits*/
+#define REG_UCSRC_URSEL_BIT                                   7   /*Must be written to 1 to address UCSRC instead of UBRRH (Shared I/O Location)*/
 #define REG_UCSRC_UMSEL_BIT                                   6
 #define REG_UCSRC_UPM1_BIT                                    5
 #define REG_UCSRC_UPM0_BIT                                    4
@@ -67,6 +73,14 @@
 #define REG_UCSRC_UCSZ0_BIT                                   1
 #define REG_UCSRC_UCPOL_BIT                                   0
 
+/*Synchronous Master Mode (XCK) Parameters*/
+#define USART_XCK_PORT                                        ENU_PORT_B
+#define USART_XCK_PIN                                         0
+#define MAX_UBRR_VALUE                                        4095
+#define UBRRH_SHIFT                                           8
+#define SYNC_MODE_DUMMY_BYTE                                  0xFF
+#define SYNC_MODE_MAX_BYTES_IN_FLIGHT                         2   /*UDR Transmit Buffer + Transmit Shift Register*/
+
 
 static uint8_type                           global_uint8_is_module_initialized          = FALSE;
 static uint8_type                           global_uint8_is_send_byte_in_progress       = FALSE;
@@ -74,6 +88,60 @@ static uint8_type                           global_uint8_is_send_buffer_in_progr
 static uint16_type                          global_uint16_number_of_bytes_sent          = 0;
 static struct_uart_configurations_type*     global_ptr_usart_database                   = NULL_PTR;
 
+/*Baud Rate Values indexed by @ref: enum_baud_rate_type. Used to calculate the UBRR value in the Synchronous Mode.*/
+static const uint32_type                    global_arr_uint32_baud_rate_values[BAUD_RATE_INVALID] = {
+                                                                                                        2400,
+                                                                                                        4800,
+                                                                                                        9600,
+                                                                                                        14400,
+                                                                                                        19200,
+                                                                                                        28800,
+                                                                                                        38400,
+                                                                                                        57600,
+                                                                                                        76800,
+                                                                                                        115200,
+                                                                                                        230400,
+                                                                                                        250000
+                                                                                                    };
+
+static void write_ubrr_value(uint16_type uint16_ubrr_value);
+static uint16_type calculate_sync_ubrr_value(uint32_type uint32_clock_rate_in_hz);
+
+/**
+ * @brief:      Function that is used to write the 12 bits UBRR Value.
+ * @note:       UBRRH shares the same I/O Location with UCSRC. Writing with URSEL cleared addresses UBRRH.
+ * 
+ * @param[in]   uint16_ubrr_value:  The UBRR Value to write.
+ * @return      None
+ */
+static void write_ubrr_value(uint16_type uint16_ubrr_value)
+{
+    REG_UBRRH = (uint8_type)((uint16_ubrr_value >> UBRRH_SHIFT) & (~(1<<REG_UCSRC_URSEL_BIT)));
+    REG_UBRRL = (uint8_type)(uint16_ubrr_value);
+}
+
+/**
+ * @brief:      Function that is used to calculate the UBRR value for the Synchronous Master Mode.
+ *              XCK Frequency = F_CPU / (2 * (UBRR + 1)). The result is rounded up to never exceed the requested clock.
+ * 
+ * @param[in]   uint32_clock_rate_in_hz:    The requested XCK Clock Rate. @note: This shall be greater than 0
+ * @return      The UBRR Value saturated to @ref: MAX_UBRR_VALUE
+ */
+static uint16_type calculate_sync_ubrr_value(uint32_type uint32_clock_rate_in_hz)
+{
+    uint32_type uint32_ubrr_value = ((F_CPU / 2) + uint32_clock_rate_in_hz - 1) / uint32_clock_rate_in_hz;
+
+    if(uint32_ubrr_value > 0)
+    {
+        uint32_ubrr_value--;
+    }
+    if(uint32_ubrr_value > MAX_UBRR_VALUE)
+    {
+        uint32_ubrr_value = MAX_UBRR_VALUE;
+    }
+    return (uint16_type)uint32_ubrr_value;
+}
+
 
 /**
  * @brief:      Function to initialize the USART Peripheral And Configure it
@@ -85,7 +153,8 @@ static struct_uart_configurations_type*     global_ptr_usart_database
  */
 sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_uart_configurations)
 {
-    sint32_type sint32_retval = SUCCESS_RETVAL;
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    uint8_type  uint8_ucsrc_value   = 0;
     if(global_uint8_is_module_initialized == FALSE)
     {
         if(ptr_struct_uart_configurations != NULL_PTR)
@@ -106,20 +175,22 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                 {
                     case UART_MODE:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UMSEL_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UMSEL_BIT);
                         CLEAR_BIT(REG_UCSRA, REG_UCSRA_U2X_BIT);
                         break;
                     }
                     case UART_MODE_DOUBLE_SPEED:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UMSEL_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UMSEL_BIT);
                         SET_BIT(REG_UCSRA, REG_UCSRA_U2X_BIT);
                         break;
                     }
                     case USART_MODE:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UMSEL_BIT);
+                        /*Synchronous Master Mode. The XCK Pin shall be output to drive the clock to the slaves.*/
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UMSEL_BIT);
                         CLEAR_BIT(REG_UCSRA, REG_UCSRA_U2X_BIT);
+                        gpio_set_pin_direction(USART_XCK_PORT, USART_XCK_PIN, ENU_DIRECTION_OUTPUT);
                         break;
                     }
                     default:
@@ -260,22 +331,28 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                     }
                 }
 
+                if((ptr_struct_uart_configurations->enum_usart_operating_mode) == USART_MODE)
+                {
+                    /*The Asynchronous Tables Above doesn't apply in the Synchronous Mode.*/
+                    write_ubrr_value(calculate_sync_ubrr_value(global_arr_uint32_baud_rate_values[ptr_struct_uart_configurations->enum_baud_rate]));
+                }
+
                 switch(ptr_struct_uart_configurations->enum_clock_polarity)
                 {
                     case NO_CLOCK_USED:
                     {
                         /*Do Nothing. As this is the default Configurations.*/
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UCPOL_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UCPOL_BIT);
                         break;
                     }
                     case INVERTED_CLOCK:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCPOL_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCPOL_BIT);
                         break;
                     }
                     case NON_INVERTED_CLOCK:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UCPOL_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UCPOL_BIT);
                         break;
                     }
                     default:
@@ -328,14 +405,14 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                     }
                     case PARITY_ODD:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UPM0_BIT);
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UPM1_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UPM0_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UPM1_BIT);
                         break;
                     }
                     case PARITY_EVEN:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UPM0_BIT);
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UPM1_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UPM0_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UPM1_BIT);
                         break;
                     }
                     default:
@@ -348,12 +425,12 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                 {
                     case STOP_BIT_1:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_USBS_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_USBS_BIT);
                         break;
                     }
                     case STOP_BIT_2:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_USBS_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_USBS_BIT);
                         break;
                     }
                     default:
@@ -366,12 +443,12 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                 {
                     case TX_ROLE_ENABLED:
                     {
-                        SET_BIT(REG_UCSRB, REG_UCSRB_RXEN_BIT);
+                        SET_BIT(REG_UCSRB, REG_UCSRB_TXEN_BIT);
                         break;
                     }
                     case RX_ROLE_ENABLED:
                     {
-                        SET_BIT(REG_UCSRB, REG_UCSRB_TXEN_BIT);
+                        SET_BIT(REG_UCSRB, REG_UCSRB_RXEN_BIT);
                         break;
                     }
                     case BOTH_TX_RX_ROLES_ENABLED:
@@ -392,36 +469,36 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                 {
                     case DATA_LENGTH_5_BITS:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UCSZ0_BIT);
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UCSZ1_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ0_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ1_BIT);
                         CLEAR_BIT(REG_UCSRB, REG_UCSRB_UCSZ2_BIT);
                         break;
                     }
                     case DATA_LENGTH_6_BITS:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCSZ0_BIT);
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UCSZ1_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ0_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ1_BIT);
                         CLEAR_BIT(REG_UCSRB, REG_UCSRB_UCSZ2_BIT);
                         break;
                     }   
                     case DATA_LENGTH_7_BITS:
                     {
-                        CLEAR_BIT(REG_UCSRC, REG_UCSRC_UCSZ0_BIT);
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCSZ1_BIT);
+                        CLEAR_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ0_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ1_BIT);
                         CLEAR_BIT(REG_UCSRB, REG_UCSRB_UCSZ2_BIT);
                         break;
                     }
                     case DATA_LENGTH_8_BITS:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCSZ0_BIT);
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCSZ1_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ0_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ1_BIT);
                         CLEAR_BIT(REG_UCSRB, REG_UCSRB_UCSZ2_BIT);
                         break;
                     }
                     case DATA_LENGTH_9_BITS:
                     {
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCSZ0_BIT);
-                        SET_BIT(REG_UCSRC, REG_UCSRC_UCSZ1_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ0_BIT);
+                        SET_BIT(uint8_ucsrc_value, REG_UCSRC_UCSZ1_BIT);
                         SET_BIT(REG_UCSRB, REG_UCSRB_UCSZ2_BIT);
                         break;
                     }
@@ -430,6 +507,8 @@ sint32_type uart_init(const struct_uart_configurations_type* const ptr_struct_ua
                         break;
                     }
                 }
+                /*UCSRC is written once with URSEL set. Otherwise the write will be directed to UBRRH.*/
+                REG_UCSRC                           = uint8_ucsrc_value | (1<<REG_UCSRC_URSEL_BIT);
                 global_ptr_usart_database           = ptr_struct_uart_configurations;
                 global_uint8_is_module_initialized  = TRUE;
             }
@@ -579,3 +658,146 @@ sint32_type uart_send_buffer(sint8_type* psint8_buffer, uint16_type uint16_buffe
     }
     return sint32_retval;
 }
+
+/**
+ * @brief:      Function that is used to change the XCK Clock Rate in the Synchronous Master Mode.
+ * @note:       The Maximum Clock Rate is F_CPU / 2.
+ * 
+ * @param[in]   uint32_clock_rate_in_hz:            The Requested XCK Clock Rate in Hz. The nearest clock rate that doesn't exceed it will be used.
+ * @param[out]  puint32_achieved_clock_rate_in_hz:  Pointer to a variable at which the achieved clock rate will be stored. This can be NULL_PTR.
+ * @return      SUCCESS_RETVAL:                     In case of Success
+ *              ERROR_MODULE_NOT_INITAILIZED:       In case that the module is not initialized.
+ *              ERROR_INVALID_ARGUMENTS:            In case that the passed arguments are not valid.
+ *              ERROR_UNSUPPORTED_FEATURE:          In case that the module is not configured in @ref: USART_MODE
+ */
+sint32_type uart_sync_set_clock_rate(uint32_type uint32_clock_rate_in_hz, uint32_type* puint32_achieved_clock_rate_in_hz)
+{
+    sint32_type sint32_retval       = SUCCESS_RETVAL;
+    uint16_type uint16_ubrr_value   = 0;
+    if(global_uint8_is_module_initialized == TRUE)
+    {
+        if((uint32_clock_rate_in_hz > 0) && (uint32_clock_rate_in_hz <= (F_CPU / 2)))
+        {
+            if((global_ptr_usart_database->enum_usart_operating_mode) == USART_MODE)
+            {
+                uint16_ubrr_value = calculate_sync_ubrr_value(uint32_clock_rate_in_hz);
+                write_ubrr_value(uint16_ubrr_value);
+                if(puint32_achieved_clock_rate_in_hz != NULL_PTR)
+                {
+                    *puint32_achieved_clock_rate_in_hz = F_CPU / (2 * ((uint32_type)uint16_ubrr_value + 1));
+                }
+            }
+            else
+            {
+                sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
+
+/**
+ * @brief:      Function that is used to Transfer A Buffer in the Synchronous Master Mode (Full Duplex).
+ *              The Transmitter is kept busy by writing the next byte in UDR while the current byte is being shifted out.
+ *              So there is no gap on XCK between the frames.
+ * @note:       In case that the Receiver is not enabled, The received data will be ignored and this function will wait until the last frame is shifted out.
+ * 
+ * @param[in]   puint8_tx_buffer:               Pointer to the buffer to transmit. This can be NULL_PTR to transmit @ref: SYNC_MODE_DUMMY_BYTE
+ * @param[out]  puint8_rx_buffer:               Pointer to the buffer to store the received data. This can be NULL_PTR to discard the received data.
+ * @param[in]   uint16_buffer_length:           The Number of bytes to transfer.
+ * @return      SUCCESS_RETVAL:                 In case of Success
+ *              ERROR_INVALID_ARGUMENTS:        In case that the passed arguments are not valid.
+ *              ERROR_MODULE_NOT_INITAILIZED:   In case that the module is not initialized.
+ *              ERROR_MODULE_BUSY:              In case that there is another send operation in progress.
+ *              ERROR_UNSUPPORTED_FEATURE:      In case that the module is not configured in @ref: USART_MODE,
+ *                                              or in case that the Transmitter is not enabled. (RX_ROLE_ENABLED) The Master drives XCK only while it transmits.
+ */
+sint32_type uart_sync_transfer_buffer(uint8_type* puint8_tx_buffer, uint8_type* puint8_rx_buffer, uint16_type uint16_buffer_length)
+{
+    sint32_type         sint32_retval           = SUCCESS_RETVAL;
+    uint16_type         uint16_tx_counter       = 0;
+    uint16_type         uint16_rx_counter       = 0;
+    uint8_type          uint8_is_rx_enabled     = FALSE;
+    volatile uint8_type uint8_received_data     = 0;
+    if(global_uint8_is_module_initialized == TRUE)
+    {
+        if(((puint8_tx_buffer != NULL_PTR) || (puint8_rx_buffer != NULL_PTR)) && (uint16_buffer_length > 0))
+        {
+            /*Each received frame is clocked by a transmitted one. So without the Transmitter no XCK clock is generated and the receive would never end.*/
+            if(((global_ptr_usart_database->enum_usart_operating_mode) != USART_MODE) || (GET_BIT(REG_UCSRB, REG_UCSRB_TXEN_BIT) == 0))
+            {
+                sint32_retval = ERROR_UNSUPPORTED_FEATURE;
+            }
+            else if((global_uint8_is_send_buffer_in_progress == TRUE) || (global_uint8_is_send_byte_in_progress == TRUE))
+            {
+                sint32_retval = ERROR_MODULE_BUSY;
+            }
+            else
+            {
+                global_uint8_is_send_buffer_in_progress = TRUE;
+                uint8_is_rx_enabled = GET_BIT(REG_UCSRB, REG_UCSRB_RXEN_BIT);
+
+                /*Flush any stale data in the receive buffer. And Clear the Transmit Complete Flag by writing 1 to it.*/
+                while(GET_BIT(REG_UCSRA, REG_UCSRA_RXC_BIT) == 1)
+                {
+                    uint8_received_data = REG_UDR;
+                }
+                SET_BIT(REG_UCSRA, REG_UCSRA_TXC_BIT);
+
+                if(uint8_is_rx_enabled == TRUE)
+                {
+                    while(uint16_rx_counter < uint16_buffer_length)
+                    {
+                        /*Never have more bytes in flight than the receive buffer can hold.*/
+                        if  (
+                                (uint16_tx_counter < uint16_buffer_length)                                          &&
+                                ((uint16_tx_counter - uint16_rx_counter) < SYNC_MODE_MAX_BYTES_IN_FLIGHT)           &&
+                                (GET_BIT(REG_UCSRA, REG_UCSRA_UDRE_BIT) == 1)
+                            )
+                        {
+                            REG_UDR = (puint8_tx_buffer != NULL_PTR) ? puint8_tx_buffer[uint16_tx_counter] : SYNC_MODE_DUMMY_BYTE;
+                            uint16_tx_counter++;
+                        }
+                        if(GET_BIT(REG_UCSRA, REG_UCSRA_RXC_BIT) == 1)
+                        {
+                            uint8_received_data = REG_UDR;
+                            if(puint8_rx_buffer != NULL_PTR)
+                            {
+                                puint8_rx_buffer[uint16_rx_counter] = uint8_received_data;
+                            }
+                            uint16_rx_counter++;
+                        }
+                    }
+                }
+                else
+                {
+                    for(uint16_tx_counter = 0; uint16_tx_counter < uint16_buffer_length; uint16_tx_counter++)
+                    {
+                        while(GET_BIT(REG_UCSRA, REG_UCSRA_UDRE_BIT) == 0);
+                        REG_UDR = (puint8_tx_buffer != NULL_PTR) ? puint8_tx_buffer[uint16_tx_counter] : SYNC_MODE_DUMMY_BYTE;
+                    }
+                    /*Wait until the last frame is shifted out on the XCK Clock.*/
+                    while(GET_BIT(REG_UCSRA, REG_UCSRA_TXC_BIT) == 0);
+                }
+                global_uint8_is_send_buffer_in_progress = FALSE;
+            }
+        }
+        else
+        {
+            sint32_retval = ERROR_INVALID_ARGUMENTS;
+        }
+    }
+    else
+    {
+        sint32_retval = ERROR_MODULE_NOT_INITAILIZED;
+    }
+    return sint32_retval;
+}
@@ -76,6 +76,8 @@ typedef enum
 /**
  * @enum:   enum_usart_operating_mode_type
  * @brief:  Enumeration that contains the Supported Operating Modes for the USART Module.
+ * @note:   USART_MODE is the Synchronous Master Mode. The Clock is driven on the XCK Pin (PB0) and the data is sampled on the edge selected by @ref: enum_clock_polarity_type.
+ *          The ATMEGA32A USART has no Master SPI Mode. So each byte is still framed by a start bit and stop bit(s) on the data line.
  */
 typedef enum
 {
@@ -209,4 +211,34 @@ sint32_type uart_receive_byte(sint8_type* psint8_data);
  */
 sint32_type uart_send_buffer(sint8_type* psint8_buffer, uint16_type uint16_buffer_length);
 
+/**
+ * @brief:      Function that is used to change the XCK Clock Rate in the Synchronous Master Mode.
+ * @note:       The Maximum Clock Rate is F_CPU / 2.
+ * 
+ * @param[in]   uint32_clock_rate_in_hz:            The Requested XCK Clock Rate in Hz. The nearest clock rate that doesn't exceed it will be used.
+ * @param[out]  puint32_achieved_clock_rate_in_hz:  Pointer to a variable at which the achieved clock rate will be stored. This can be NULL_PTR.
+ * @return      SUCCESS_RETVAL:                     In case of Success
+ *              ERROR_MODULE_NOT_INITAILIZED:       In case that the module is not initialized.
+ *              ERROR_INVALID_ARGUMENTS:            In case that the passed arguments are not valid.
+ *              ERROR_UNSUPPORTED_FEATURE:          In case that the module is not configured in @ref: USART_MODE
+ */
+sint32_type uart_sync_set_clock_rate(uint32_type uint32_clock_rate_in_hz, uint32_type* puint32_achieved_clock_rate_in_hz);
+
+/**
+ * @brief:      Function that is used to Transfer A Buffer in the Synchronous Master Mode (Full Duplex).
+ *              The Transmitter is kept busy by writing the next byte in UDR while the current byte is being shifted out.
+ * @note:       In case that the Receiver is not enabled, The received data will be ignored and this function will wait until the last frame is shifted out.
+ * 
+ * @param[in]   puint8_tx_buffer:               Pointer to the buffer to transmit. This can be NULL_PTR to transmit dummy bytes (0xFF).
+ * @param[out]  puint8_rx_buffer:               Pointer to the buffer to store the received data. This can be NULL_PTR to discard the received data.
+ * @param[in]   uint16_buffer_length:           The Number of bytes to transfer.
+ * @return      SUCCESS_RETVAL:                 In case of Success
+ *              ERROR_INVALID_ARGUMENTS:        In case that the passed arguments are not valid.
+ *              ERROR_MODULE_NOT_INITAILIZED:   In case that the module is not initialized.
+ *              ERROR_MODULE_BUSY:              In case that there is another send operation in progress.
+ *              ERROR_UNSUPPORTED_FEATURE:      In case that the module is not configured in @ref: USART_MODE,
+ *                                              or in case that the Transmitter is not enabled. (RX_ROLE_ENABLED) The Master drives XCK only while it transmits.
+ */
+sint32_type uart_sync_transfer_buffer(uint8_type* puint8_tx_buffer, uint8_type* puint8_rx_buffer, uint16_type uint16_buffer_length);
+
 #endif /*__UART_H__*/
\ No newline at end of file